@@ -3,6 +3,8 @@
 
 #cmakedefine01 HAVE_X11
 
+#cmakedefine01 HAVE_XCB_SHM
+
 #cmakedefine KF5_VERSION_MINOR @KF5_VERSION_MINOR@
 
 #cmakedefine VERSION "@VERSION@"
@@ -55,6 +55,7 @@ template <class T>
 GenericTable<T> &GenericTable<T>::operator=(const GenericTable<T> &rhs)
 {
     m_list = rhs.m_list;
+    invalidateIndex();
 
     return (*this);
 }
@@ -63,6 +64,7 @@ template <class T>
 GenericTable<T> &GenericTable<T>::operator=(GenericTable<T> &&rhs)
 {
     m_list = rhs.m_list;
+    invalidateIndex();
     return (*this);
 }
 
@@ -70,7 +72,9 @@ template <class T>
 GenericTable<T> &GenericTable<T>::operator<<(const T &rhs)
 {
     if (!rhs.id.isEmpty()) {
+        refreshHandedOutRow();
         m_list << rhs;
+        indexRow(m_list.count() - 1);
     }
 
     return (*this);
@@ -79,14 +83,29 @@ GenericTable<T> &GenericTable<T>::operator<<(const T &rhs)
 template <class T>
 GenericTable<T> &GenericTable<T>::operator<<(const GenericTable<T> &rhs)
 {
+    refreshHandedOutRow();
+
+    const int firstrow = m_list.count();
     m_list << rhs.m_list;
+
+    for(int i=firstrow; i<m_list.count(); ++i) {
+        indexRow(i);
+    }
+
     return (*this);
 }
 
 template <class T>
 GenericTable<T> &GenericTable<T>::insert(const int &pos, const T &rhs)
 {
+    refreshHandedOutRow();
     m_list.insert(pos, rhs);
+
+    //! QList::insert clamps out of range positions
+    const int row = qBound(0, pos, m_list.count() - 1);
+    shiftIndex(row, 1);
+    indexRow(row);
+
     return (*this);
 }
 
@@ -133,36 +152,23 @@ bool GenericTable<T>::operator!=(const GenericTable<T> &rhs) const
 template <class T>
 T &GenericTable<T>::operator[](const QString &id)
 {
-    int pos{-1};
-
-    for(int i=0; i<m_list.count(); ++i) {
-        if (m_list[i].id == id){
-            pos = i;
-            break;
-        }
-    }
+    const int pos = rowForId(id);
 
+    //! caller may change the record id or name through the returned reference
+    handOutRow(pos);
     return m_list[pos];
 }
 
 template <class T>
 const T GenericTable<T>::operator[](const QString &id) const
 {
-    int pos{-1};
-
-    for(int i=0; i<m_list.count(); ++i) {
-        if (m_list[i].id == id){
-            pos = i;
-            break;
-        }
-    }
-
-    return m_list[pos];
+    return m_list[rowForId(id)];
 }
 
 template <class T>
 T &GenericTable<T>::operator[](const uint &index)
 {
+    handOutRow(index);
     return m_list[index];
 }
 
@@ -175,25 +181,13 @@ const T GenericTable<T>::operator[](const uint &index) const
 template <class T>
 bool GenericTable<T>::containsId(const QString &id) const
 {
-    for(int i=0; i<m_list.count(); ++i) {
-        if (m_list[i].id == id){
-            return true;
-        }
-    }
-
-    return false;
+    return (rowForId(id) >= 0);
 }
 
 template <class T>
 bool GenericTable<T>::containsName(const QString &name) const
 {
-    for(int i=0; i<m_list.count(); ++i) {
-        if (m_list[i].name == name){
-            return true;
-        }
-    }
-
-    return false;
+    return (rowForName(name) >= 0);
 }
 
 template <class T>
@@ -205,13 +199,7 @@ bool GenericTable<T>::rowExists(const int &row) const
 template <class T>
 int GenericTable<T>::indexOf(const QString &id) const
 {
-    for(int i=0; i<m_list.count(); ++i) {
-        if (m_list[i].id == id){
-            return i;
-        }
-    }
-
-    return -1;
+    return rowForId(id);
 }
 
 template <class T>
@@ -255,13 +243,8 @@ int GenericTable<T>::sortedPosForName(const QString &name) const
 template <class T>
 QString GenericTable<T>::idForName(const QString &name) const
 {
-    for(int  i=0; i<m_list.count(); ++i) {
-        if (m_list[i].name == name) {
-            return m_list[i].id;
-        }
-    }
-
-    return QString();
+    const int row = rowForName(name);
+    return (row >= 0 ? m_list[row].id : QString());
 }
 
 template <class T>
@@ -280,24 +263,220 @@ template <class T>
 void GenericTable<T>::clear()
 {
     m_list.clear();
+    invalidateIndex();
 }
 
 template <class T>
 void GenericTable<T>::remove(const QString &id)
 {
-    const int pos = indexOf(id);
+    remove(indexOf(id));
+}
+
+template <class T>
+void GenericTable<T>::remove(const int &row)
+{
+    if (!rowExists(row)) {
+        return;
+    }
+
+    refreshHandedOutRow();
+
+    const QString id = m_list[row].id;
+    const QString name = m_list[row].name;
+
+    m_list.removeAt(row);
+
+    if (!m_indexed) {
+        return;
+    }
+
+    if (m_idRows.value(id, -1) == row) {
+        m_idRows.remove(id);
+    }
+
+    if (m_nameRows.value(name, -1) == row) {
+        m_nameRows.remove(name);
+    }
+
+    shiftIndex(row + 1, -1);
 
-    if (pos >= 0) {
-        m_list.removeAt(pos);
+    //! restore duplicates that were hidden by the removed record
+    for(int i=row; i<m_list.count(); ++i) {
+        if (m_list[i].id == id || m_list[i].name == name) {
+            indexRow(i);
+        }
     }
 }
 
+//! Index
 template <class T>
-void GenericTable<T>::remove(const int &row)
+void GenericTable<T>::invalidateIndex()
+{
+    m_indexed = false;
+    m_indexMaybeStale = false;
+    m_handedOutRow = -1;
+    m_idRows.clear();
+    m_nameRows.clear();
+}
+
+template <class T>
+void GenericTable<T>::indexRow(const int &row) const
+{
+    if (!m_indexed) {
+        return;
+    }
+
+    //! first record wins for duplicate ids or names, same as a linear search
+    const QString &id = m_list[row].id;
+    const QString &name = m_list[row].name;
+
+    if (m_idRows.value(id, row + 1) > row) {
+        m_idRows[id] = row;
+    }
+
+    if (m_nameRows.value(name, row + 1) > row) {
+        m_nameRows[name] = row;
+    }
+}
+
+template <class T>
+void GenericTable<T>::rebuildIndex() const
+{
+    m_idRows.clear();
+    m_nameRows.clear();
+    m_idRows.reserve(m_list.count());
+    m_nameRows.reserve(m_list.count());
+
+    m_indexed = true;
+    m_indexMaybeStale = false;
+    m_handedOutRow = -1;
+
+    for(int i=0; i<m_list.count(); ++i) {
+        indexRow(i);
+    }
+}
+
+template <class T>
+void GenericTable<T>::shiftIndex(const int &fromRow, const int &offset)
+{
+    if (!m_indexed) {
+        return;
+    }
+
+    for (auto it = m_idRows.begin(); it != m_idRows.end(); ++it) {
+        if (it.value() >= fromRow) {
+            it.value() += offset;
+        }
+    }
+
+    for (auto it = m_nameRows.begin(); it != m_nameRows.end(); ++it) {
+        if (it.value() >= fromRow) {
+            it.value() += offset;
+        }
+    }
+}
+
+template <class T>
+void GenericTable<T>::handOutRow(const int &row)
+{
+    refreshHandedOutRow();
+
+    if (!m_indexed || row < 0 || row >= m_list.count()) {
+        return;
+    }
+
+    m_handedOutRow = row;
+    m_handedOutId = m_list[row].id;
+    m_handedOutName = m_list[row].name;
+    m_indexMaybeStale = true;
+}
+
+template <class T>
+void GenericTable<T>::refreshHandedOutRow() const
+{
+    if (m_handedOutRow < 0) {
+        return;
+    }
+
+    const int row = m_handedOutRow;
+    m_handedOutRow = -1;
+
+    if (!m_indexed || row >= m_list.count()) {
+        return;
+    }
+
+    //! a changed id or name hands its entry over to the next record with the same value
+    if (m_list[row].id != m_handedOutId && m_idRows.value(m_handedOutId, -1) == row) {
+        m_idRows.remove(m_handedOutId);
+
+        for(int i=row+1; i<m_list.count(); ++i) {
+            if (m_list[i].id == m_handedOutId) {
+                m_idRows[m_handedOutId] = i;
+                break;
+            }
+        }
+    }
+
+    if (m_list[row].name != m_handedOutName && m_nameRows.value(m_handedOutName, -1) == row) {
+        m_nameRows.remove(m_handedOutName);
+
+        for(int i=row+1; i<m_list.count(); ++i) {
+            if (m_list[i].name == m_handedOutName) {
+                m_nameRows[m_handedOutName] = i;
+                break;
+            }
+        }
+    }
+
+    indexRow(row);
+}
+
+template <class T>
+int GenericTable<T>::rowForId(const QString &id) const
+{
+    if (!m_indexed) {
+        rebuildIndex();
+    }
+
+    refreshHandedOutRow();
+
+    int row = m_idRows.value(id, -1);
+
+    if (row >= 0 && row < m_list.count() && m_list[row].id == id) {
+        return row;
+    }
+
+    //! a record that was handed out earlier may have been changed after it was refreshed
+    if (m_indexMaybeStale) {
+        rebuildIndex();
+        row = m_idRows.value(id, -1);
+    }
+
+    return (row >= 0 && row < m_list.count() && m_list[row].id == id) ? row : -1;
+}
+
+template <class T>
+int GenericTable<T>::rowForName(const QString &name) const
 {
-    if (rowExists(row)) {
-        m_list.removeAt(row);
+    if (!m_indexed) {
+        rebuildIndex();
+    }
+
+    refreshHandedOutRow();
+
+    int row = m_nameRows.value(name, -1);
+
+    if (row >= 0 && row < m_list.count() && m_list[row].name == name) {
+        return row;
+    }
+
+    //! a record that was handed out earlier may have been changed after it was refreshed
+    if (m_indexMaybeStale) {
+        rebuildIndex();
+        row = m_nameRows.value(name, -1);
     }
+
+    return (row >= 0 && row < m_list.count() && m_list[row].name == name) ? row : -1;
 }
 
 //! Make linker happy and provide which table instances will be used.
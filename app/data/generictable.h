@@ -25,6 +25,7 @@
 #include "genericdata.h"
 
 // Qt
+#include <QHash>
 #include <QList>
 
 namespace Latte {
@@ -72,10 +73,39 @@ public:
     void remove(const int &row);
     void remove(const QString &id);
 
+protected:
+    //! must be called whenever m_list is modified directly
+    void invalidateIndex();
+
+private:
+    void indexRow(const int &row) const;
+    void rebuildIndex() const;
+    void handOutRow(const int &row);
+    void refreshHandedOutRow() const;
+    void shiftIndex(const int &fromRow, const int &offset);
+
+    int rowForId(const QString &id) const;
+    int rowForName(const QString &name) const;
+
 protected:
     //! #id, record
     QList<T> m_list;
 
+private:
+    //! lookup tables for ids and names, they are built lazily. The last record handed
+    //! out through a non-const accessor is re-indexed on the next lookup because its
+    //! id or name may have changed. Lookups that miss are retried after a full rebuild
+    //! only when records were handed out since the last one. Inserting or removing a
+    //! record in the middle shifts the following rows in both tables, which is linear
+    //! like the QList insertion itself
+    mutable bool m_indexed{false};
+    mutable bool m_indexMaybeStale{false};
+    mutable int m_handedOutRow{-1};
+    mutable QString m_handedOutId;
+    mutable QString m_handedOutName;
+    mutable QHash<QString, int> m_idRows;
+    mutable QHash<QString, int> m_nameRows;
+
 };
 
 }
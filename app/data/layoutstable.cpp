@@ -46,12 +46,14 @@ LayoutsTable::LayoutsTable(const LayoutsTable &o)
 LayoutsTable &LayoutsTable::operator=(const LayoutsTable &rhs)
 {
     m_list = rhs.m_list;
+    invalidateIndex();
     return (*this);
 }
 
 LayoutsTable &LayoutsTable::operator=(LayoutsTable &&rhs)
 {
     m_list = rhs.m_list;
+    invalidateIndex();
     return (*this);
 }
 
@@ -0,0 +1,30 @@
+/*
+*  Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LATTEDEBUG_H
+#define LATTEDEBUG_H
+
+// Qt
+#include <QLoggingCategory>
+
+//! timings and cache statistics, they can be enabled with:
+//! QT_LOGGING_RULES="org.kde.latte.performance.debug=true"
+Q_DECLARE_LOGGING_CATEGORY(LATTE_PERFORMANCE)
+
+#endif
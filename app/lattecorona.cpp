@@ -24,6 +24,7 @@
 #include <coretypes.h>
 #include "alternativeshelper.h"
 #include "apptypes.h"
+#include "debug.h"
 #include "lattedockadaptor.h"
 #include "screenpool.h"
 #include "declarativeimports/interfaces.h"
@@ -56,6 +57,9 @@
 #include "wm/tracker/schemes.h"
 #include "wm/tracker/windowstracker.h"
 
+// C++
+#include <algorithm>
+
 // Qt
 #include <QAction>
 #include <QApplication>
@@ -206,6 +210,8 @@ Corona::~Corona()
     delete m_activitiesConsumer;
 
     qDebug() << "Latte Corona - deleted...";
+    qCDebug(LATTE_PERFORMANCE) << "Latte Corona - available screen geometries cache hits:" << m_availableScreenGeometriesHits
+                               << "misses:" << m_availableScreenGeometriesMisses;
 
     if (!m_importFullConfigurationFile.isEmpty()) {
         //!NOTE: Restart latte to import the new configuration
@@ -226,6 +232,12 @@ void Corona::load()
         m_templatesManager->init();
         m_layoutsManager->init();
 
+        connect(this, &Corona::availableScreenRectChangedFrom, this, &Corona::invalidateAvailableScreenGeometries);
+        connect(this, &Corona::availableScreenRegionChangedFrom, this, &Corona::invalidateAvailableScreenGeometries);
+        connect(m_activitiesConsumer, &KActivities::Consumer::currentActivityChanged, this, &Corona::invalidateAvailableScreenGeometries);
+        connect(m_activitiesConsumer, &KActivities::Consumer::runningActivitiesChanged, this, &Corona::invalidateAvailableScreenGeometries);
+        connect(m_layoutsManager->synchronizer(), &Layouts::Synchronizer::centralLayoutsChanged, this, &Corona::invalidateAvailableScreenGeometries);
+
         connect(this, &Corona::availableScreenRectChangedFrom, this, &Plasma::Corona::availableScreenRectChanged);
         connect(this, &Corona::availableScreenRegionChangedFrom, this, &Plasma::Corona::availableScreenRegionChanged);
         connect(qGuiApp, &QGuiApplication::primaryScreenChanged, this, &Corona::primaryOutputChanged, Qt::UniqueConnection);
@@ -529,12 +541,72 @@ QRegion Corona::availableScreenRegion(int id) const
     return availableScreenRegionWithCriteria(id);
 }
 
+void Corona::invalidateAvailableScreenGeometries()
+{
+    m_availableScreenRects.clear();
+    m_availableScreenRegions.clear();
+}
+
+QString Corona::availableScreenGeometryKey(int id,
+                                           QString activityid,
+                                           QList<Types::Visibility> ignoreModes,
+                                           QList<Plasma::Types::Location> ignoreEdges,
+                                           bool ignoreExternalPanels,
+                                           bool desktopUse) const
+{
+    if (activityid.isEmpty()) {
+        activityid = m_activitiesConsumer->currentActivity();
+    }
+
+    std::sort(ignoreModes.begin(), ignoreModes.end());
+    std::sort(ignoreEdges.begin(), ignoreEdges.end());
+
+    QString key = QString::number(id) + "_" + activityid + "_" + (ignoreExternalPanels ? "1" : "0") + (desktopUse ? "1" : "0") + "_";
+
+    for (const auto mode : ignoreModes) {
+        key += QString::number(mode) + ",";
+    }
+
+    key += "_";
+
+    for (const auto edge : ignoreEdges) {
+        key += QString::number(edge) + ",";
+    }
+
+    return key;
+}
+
 QRegion Corona::availableScreenRegionWithCriteria(int id,
                                                   QString activityid,
                                                   QList<Types::Visibility> ignoreModes,
                                                   QList<Plasma::Types::Location> ignoreEdges,
                                                   bool ignoreExternalPanels,
                                                   bool desktopUse) const
+{
+    const QString key = availableScreenGeometryKey(id, activityid, ignoreModes, ignoreEdges, ignoreExternalPanels, desktopUse);
+
+    if (m_availableScreenRegions.contains(key)) {
+        m_availableScreenGeometriesHits++;
+        return m_availableScreenRegions[key];
+    }
+
+    m_availableScreenGeometriesMisses++;
+
+    const QRegion available = calculateAvailableScreenRegion(id, activityid, ignoreModes, ignoreEdges, ignoreExternalPanels, desktopUse);
+
+    if (m_screenPool->screenForId(id)) {
+        m_availableScreenRegions[key] = available;
+    }
+
+    return available;
+}
+
+QRegion Corona::calculateAvailableScreenRegion(int id,
+                                               QString activityid,
+                                               QList<Types::Visibility> ignoreModes,
+                                               QList<Plasma::Types::Location> ignoreEdges,
+                                               bool ignoreExternalPanels,
+                                               bool desktopUse) const
 {
     const QScreen *screen = m_screenPool->screenForId(id);
     bool inCurrentActivity{activityid.isEmpty()};
@@ -729,6 +801,31 @@ QRect Corona::availableScreenRectWithCriteria(int id,
                                               QList<Plasma::Types::Location> ignoreEdges,
                                               bool ignoreExternalPanels,
                                               bool desktopUse) const
+{
+    const QString key = availableScreenGeometryKey(id, activityid, ignoreModes, ignoreEdges, ignoreExternalPanels, desktopUse);
+
+    if (m_availableScreenRects.contains(key)) {
+        m_availableScreenGeometriesHits++;
+        return m_availableScreenRects[key];
+    }
+
+    m_availableScreenGeometriesMisses++;
+
+    const QRect available = calculateAvailableScreenRect(id, activityid, ignoreModes, ignoreEdges, ignoreExternalPanels, desktopUse);
+
+    if (m_screenPool->screenForId(id)) {
+        m_availableScreenRects[key] = available;
+    }
+
+    return available;
+}
+
+QRect Corona::calculateAvailableScreenRect(int id,
+                                           QString activityid,
+                                           QList<Types::Visibility> ignoreModes,
+                                           QList<Plasma::Types::Location> ignoreEdges,
+                                           bool ignoreExternalPanels,
+                                           bool desktopUse) const
 {
     const QScreen *screen = m_screenPool->screenForId(id);
     bool inCurrentActivity{activityid.isEmpty()};
@@ -824,13 +921,18 @@ void Corona::addOutput(QScreen *screen)
 {
     Q_ASSERT(screen);
 
+    invalidateAvailableScreenGeometries();
+
     int id = m_screenPool->id(screen->name());
 
     if (id == -1) {
         m_screenPool->insertScreenMapping(screen->name());
     }
 
+    connect(screen, &QScreen::availableGeometryChanged, this, &Corona::invalidateAvailableScreenGeometries);
     connect(screen, &QScreen::geometryChanged, this, [ = ]() {
+        invalidateAvailableScreenGeometries();
+
         const int id = m_screenPool->id(screen->name());
 
         if (id >= 0) {
@@ -858,6 +960,7 @@ void Corona::screenRemoved(QScreen *screen)
 
 void Corona::screenCountChanged()
 {
+    invalidateAvailableScreenGeometries();
     m_viewsScreenSyncTimer.start();
 }
 
@@ -129,6 +129,9 @@ public:
                                               bool ignoreExternalPanels = true,
                                               bool desktopUse = false) const;
 
+    //! must be called whenever a change may affect the available screen geometries
+    void invalidateAvailableScreenGeometries();
+
     int screenForContainment(const Plasma::Containment *containment) const override;
 
     KWayland::Client::PlasmaShell *waylandCoronaInterface() const;
@@ -210,6 +213,27 @@ private:
     Layout::GenericLayout *layout(QString name) const;
     CentralLayout *centralLayout(QString name) const;
 
+    QString availableScreenGeometryKey(int id,
+                                       QString activityid,
+                                       QList<Types::Visibility> ignoreModes,
+                                       QList<Plasma::Types::Location> ignoreEdges,
+                                       bool ignoreExternalPanels,
+                                       bool desktopUse) const;
+
+    QRect calculateAvailableScreenRect(int id,
+                                       QString activityid,
+                                       QList<Types::Visibility> ignoreModes,
+                                       QList<Plasma::Types::Location> ignoreEdges,
+                                       bool ignoreExternalPanels,
+                                       bool desktopUse) const;
+
+    QRegion calculateAvailableScreenRegion(int id,
+                                           QString activityid,
+                                           QList<Types::Visibility> ignoreModes,
+                                           QList<Plasma::Types::Location> ignoreEdges,
+                                           bool ignoreExternalPanels,
+                                           bool desktopUse) const;
+
 private:
 
     bool m_activitiesStarting{true};
@@ -229,6 +253,13 @@ private:
 
     QTimer m_viewsScreenSyncTimer;
 
+    //! available screen geometries are requested many times with the same criteria,
+    //! they are cached until a view, screen, layout or activity change invalidates them
+    mutable QHash<QString, QRect> m_availableScreenRects;
+    mutable QHash<QString, QRegion> m_availableScreenRegions;
+    mutable quint64 m_availableScreenGeometriesHits{0};
+    mutable quint64 m_availableScreenGeometriesMisses{0};
+
     KActivities::Consumer *m_activitiesConsumer;
     QPointer<KAboutApplicationDialog> aboutDialog;
 
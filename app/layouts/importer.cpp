@@ -31,11 +31,13 @@
 
 // Qt
 #include <QFile>
+#include <QTemporaryFile>
 
 // KDE
 #include <KArchive/KTar>
 #include <KArchive/KArchiveEntry>
 #include <KArchive/KArchiveDirectory>
+#include <KArchive/KArchiveFile>
 #include <KConfigGroup>
 #include <KLocalizedString>
 #include <KNotification>
@@ -323,36 +325,44 @@ bool Importer::importOldConfiguration(QString oldConfigPath, QString newName)
     qDebug() << "temp layout directory : " << tempDir.absolutePath();
 
     if (rootDir) {
-        if (!tempDir.exists())
-            tempDir.mkpath(tempDir.absolutePath());
-
+        //! the archive format is validated from its index and only the applets file that
+        //! is needed for the import is extracted
         for(const auto &name : rootDir->entries()) {
             auto fileEntry = rootDir->file(name);
 
-            if (fileEntry && (fileEntry->name() == "lattedockrc"
-                              || fileEntry->name() == "lattedock-appletsrc")) {
-                if (!fileEntry->copyTo(tempDir.absolutePath())) {
-                    qInfo() << i18nc("import/export config", "The extracted file could not be copied!!!");
-                    archive.close();
-                    return false;
-                }
-            } else {
+            if (!fileEntry || (fileEntry->name() != "lattedockrc"
+                               && fileEntry->name() != "lattedock-appletsrc")) {
                 qInfo() << i18nc("import/export config", "The file has a wrong format!!!");
                 archive.close();
                 return false;
             }
         }
+
+        if (!rootDir->file("lattedockrc") || !rootDir->file("lattedock-appletsrc")) {
+            archive.close();
+            return false;
+        }
+
+        if (!tempDir.exists())
+            tempDir.mkpath(tempDir.absolutePath());
+
+        if (!rootDir->file("lattedock-appletsrc")->copyTo(tempDir.absolutePath())) {
+            qInfo() << i18nc("import/export config", "The extracted file could not be copied!!!");
+            archive.close();
+            return false;
+        }
     } else {
         qInfo() << i18nc("import/export config", "The temp directory could not be created!!!");
         archive.close();
         return false;
     }
 
+    archive.close();
+
     //! only if the above has passed we must process the files
     QString appletsPath(tempDir.absolutePath() + "/lattedock-appletsrc");
-    QString screensPath(tempDir.absolutePath() + "/lattedockrc");
 
-    if (!QFile(appletsPath).exists() || !QFile(screensPath).exists()) {
+    if (!QFile(appletsPath).exists()) {
         return false;
     }
 
@@ -459,7 +469,7 @@ Importer::LatteFileVersion Importer::fileVersion(QString file)
         return Importer::UnknownFileType;
     }
 
-    QTemporaryDir archiveTempDir;
+    const KArchiveDirectory *rootDir = archive.directory();
 
     bool version1rc = false;
     bool version1applets = false;
@@ -468,43 +478,30 @@ Importer::LatteFileVersion Importer::fileVersion(QString file)
     bool version2LatteDir = false;
     bool version2layout = false;
 
-    archive.directory()->copyTo(archiveTempDir.path());
-
-
     //rc file
-    QString rcFile(archiveTempDir.path() + "/lattedockrc");
+    int rcVersion = archivedConfigVersion(rootDir, "lattedockrc", "UniversalSettings");
 
-    if (QFile(rcFile).exists()) {
-        KSharedConfigPtr lConfig = KSharedConfig::openConfig(rcFile);
-        KConfigGroup universalGroup = KConfigGroup(lConfig, "UniversalSettings");
-        int version = universalGroup.readEntry("version", 1);
-
-        if (version == 1) {
-            version1rc = true;
-        } else if (version == 2) {
-            version2rc = true;
-        }
+    if (rcVersion == 1) {
+        version1rc = true;
+    } else if (rcVersion == 2) {
+        version2rc = true;
     }
 
     //applets file
-    QString appletsFile(archiveTempDir.path() + "/lattedock-appletsrc");
+    if (version1rc) {
+        int appletsVersion = archivedConfigVersion(rootDir, "lattedock-appletsrc", "LayoutSettings");
 
-    if (QFile(appletsFile).exists() && version1rc) {
-        KSharedConfigPtr lConfig = KSharedConfig::openConfig(appletsFile);
-        KConfigGroup generalGroup = KConfigGroup(lConfig, "LayoutSettings");
-        int version = generalGroup.readEntry("version", 1);
-
-        if (version == 1) {
+        if (appletsVersion == 1) {
             version1applets = true;
-        } else if (version == 2) {
+        } else if (appletsVersion == 2) {
             version2layout = true;
         }
     }
 
     //latte directory
-    QString latteDir(archiveTempDir.path() + "/latte");
+    const KArchiveEntry *latteDir = rootDir ? rootDir->entry("latte") : nullptr;
 
-    if (QDir(latteDir).exists()) {
+    if (latteDir && latteDir->isDirectory()) {
         version2LatteDir = true;
     }
 
@@ -517,6 +514,30 @@ Importer::LatteFileVersion Importer::fileVersion(QString file)
     return Importer::UnknownFileType;
 }
 
+int Importer::archivedConfigVersion(const KArchiveDirectory *rootDir, const QString &fileName, const QString &groupName)
+{
+    const KArchiveFile *configFile = rootDir ? rootDir->file(fileName) : nullptr;
+
+    if (!configFile) {
+        return -1;
+    }
+
+    //! only this small config entry is written out, in order to be parsed through KConfig
+    QTemporaryFile tempConfigFile;
+
+    if (!tempConfigFile.open()) {
+        return -1;
+    }
+
+    tempConfigFile.write(configFile->data());
+    tempConfigFile.close();
+
+    KSharedConfigPtr lConfig = KSharedConfig::openConfig(tempConfigFile.fileName());
+    KConfigGroup group = KConfigGroup(lConfig, groupName);
+
+    return group.readEntry("version", 1);
+}
+
 bool Importer::importHelper(QString fileName)
 {
     LatteFileVersion version = fileVersion(fileName);
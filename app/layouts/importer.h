@@ -25,6 +25,8 @@
 #include <QObject>
 #include <QTemporaryDir>
 
+class KArchiveDirectory;
+
 namespace Latte {
 namespace Layouts {
 class Manager;
@@ -118,6 +120,10 @@ private:
     //! the new layout path and an empty string if it cant
     QString layoutCanBeImported(QString oldAppletsPath, QString newName, QString exportDirectory = QString());
 
+    //! reads the version of a config group from a single file of an archive instead of
+    //! extracting the whole archive, it returns -1 when that file can not be read
+    static int archivedConfigVersion(const KArchiveDirectory *rootDir, const QString &fileName, const QString &groupName);
+
     QTemporaryDir m_storageTmpDir;
 
     Layouts::Manager *m_manager;
@@ -0,0 +1,179 @@
+/*
+*  Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "layoutsindex.h"
+
+// local
+#include "../layout/centrallayout.h"
+
+// Qt
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+//! must be increased whenever the layouts metadata or the file format are changed
+#define LAYOUTSINDEXVERSION 1
+#define LAYOUTSINDEXMAGIC 0x4C4C4958
+#define LAYOUTSINDEXFILE "lattedock/layouts.index"
+
+namespace Latte {
+namespace Layouts {
+
+LayoutsIndex::LayoutsIndex()
+{
+    m_indexFile = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + QLatin1Char('/') + LAYOUTSINDEXFILE;
+    load();
+}
+
+LayoutsIndex::~LayoutsIndex()
+{
+    save();
+}
+
+Data::Layout LayoutsIndex::layout(const QString &layoutpath)
+{
+    const QFileInfo layoutInfo(layoutpath);
+    const qint64 size = layoutInfo.size();
+    const qint64 lastModified = layoutInfo.lastModified().toMSecsSinceEpoch();
+
+    auto cached = m_entries.constFind(layoutpath);
+
+    Data::Layout data;
+
+    if (cached != m_entries.constEnd() && cached.value().size == size && cached.value().lastModified == lastModified) {
+        data = cached.value().data;
+    } else {
+        CentralLayout centrallayout(nullptr, layoutpath);
+        data = centrallayout.data();
+
+        indexEntry entry;
+        entry.size = size;
+        entry.lastModified = lastModified;
+        entry.data = data;
+
+        m_entries[layoutpath] = entry;
+        m_changed = true;
+    }
+
+    //! permissions changes do not update the modification time
+    data.isLocked = layoutInfo.exists() && !layoutInfo.isWritable();
+
+    return data;
+}
+
+void LayoutsIndex::prune(const QStringList &layoutpaths)
+{
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (!layoutpaths.contains(it.key())) {
+            it = m_entries.erase(it);
+            m_changed = true;
+        } else {
+            ++it;
+        }
+    }
+}
+
+void LayoutsIndex::load()
+{
+    QFile indexFile(m_indexFile);
+
+    if (!indexFile.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream in(&indexFile);
+    in.setVersion(QDataStream::Qt_5_9);
+
+    quint32 magic{0};
+    quint32 version{0};
+    quint32 count{0};
+
+    in >> magic >> version >> count;
+
+    if (magic != LAYOUTSINDEXMAGIC || version != LAYOUTSINDEXVERSION) {
+        qDebug() << "Layouts index is ignored because it is not compatible :: " << m_indexFile;
+        return;
+    }
+
+    QHash<QString, indexEntry> loaded;
+
+    for (quint32 i=0; i<count && in.status() == QDataStream::Ok; ++i) {
+        QString layoutpath;
+        indexEntry entry;
+        qint32 backgroundStyle{0};
+
+        in >> layoutpath >> entry.size >> entry.lastModified
+           >> entry.data.id >> entry.data.name >> entry.data.icon >> entry.data.color
+           >> entry.data.background >> entry.data.textColor >> entry.data.lastUsedActivity
+           >> entry.data.isBroken >> entry.data.isShownInMenu >> entry.data.hasDisabledBorders
+           >> entry.data.activities >> backgroundStyle;
+
+        entry.data.backgroundStyle = static_cast<Latte::Layout::BackgroundStyle>(backgroundStyle);
+        loaded[layoutpath] = entry;
+    }
+
+    if (in.status() != QDataStream::Ok) {
+        qDebug() << "Layouts index is ignored because it is corrupted :: " << m_indexFile;
+        return;
+    }
+
+    m_entries = loaded;
+}
+
+void LayoutsIndex::save()
+{
+    if (!m_changed) {
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(m_indexFile).absolutePath());
+
+    QSaveFile indexFile(m_indexFile);
+
+    if (!indexFile.open(QIODevice::WriteOnly)) {
+        qDebug() << "Layouts index can not be written :: " << m_indexFile;
+        return;
+    }
+
+    QDataStream out(&indexFile);
+    out.setVersion(QDataStream::Qt_5_9);
+
+    out << (quint32)LAYOUTSINDEXMAGIC << (quint32)LAYOUTSINDEXVERSION << (quint32)m_entries.count();
+
+    for (auto it = m_entries.constBegin(); it != m_entries.constEnd(); ++it) {
+        const indexEntry &entry = it.value();
+
+        out << it.key() << entry.size << entry.lastModified
+            << entry.data.id << entry.data.name << entry.data.icon << entry.data.color
+            << entry.data.background << entry.data.textColor << entry.data.lastUsedActivity
+            << entry.data.isBroken << entry.data.isShownInMenu << entry.data.hasDisabledBorders
+            << entry.data.activities << (qint32)entry.data.backgroundStyle;
+    }
+
+    if (indexFile.commit()) {
+        m_changed = false;
+    }
+}
+
+}
+}
@@ -0,0 +1,72 @@
+/*
+*  Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LAYOUTSINDEX_H
+#define LAYOUTSINDEX_H
+
+// local
+#include "../data/layoutdata.h"
+
+// Qt
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+namespace Latte {
+namespace Layouts {
+
+//! Persistent index of the stored layouts metadata. Layout files are parsed
+//! only when they are not indexed yet or their modification time or size
+//! changed since they were indexed
+class LayoutsIndex
+{
+public:
+    LayoutsIndex();
+    ~LayoutsIndex();
+
+    //! returns the metadata of an inactive layout
+    Data::Layout layout(const QString &layoutpath);
+
+    //! removes files that are not present in layoutpaths
+    void prune(const QStringList &layoutpaths);
+    //! writes the index file only when it was changed
+    void save();
+
+private:
+    struct indexEntry {
+        qint64 size{0};
+        qint64 lastModified{0};
+        Data::Layout data;
+    };
+
+    void load();
+
+private:
+    bool m_changed{false};
+
+    QString m_indexFile;
+
+    //! layout file path, metadata
+    QHash<QString, indexEntry> m_entries;
+};
+
+}
+}
+
+#endif
@@ -275,8 +275,7 @@ void Synchronizer::updateLayoutsTable()
 
     for (int i = 0; i < m_layouts.rowCount(); ++i) {
         if (m_layouts[i].isBroken && !m_layouts[i].isActive) {
-            CentralLayout central(this, m_layouts[i].id);
-            m_layouts[i].isBroken = central.isBroken();
+            m_layouts[i].isBroken = m_layoutsIndex.layout(m_layouts[i].id).isBroken;
         }
     }
 }
@@ -533,6 +532,7 @@ void Synchronizer::initLayouts()
     QStringList filter;
     filter.append(QString("*.layout.latte"));
     QStringList files = layoutDir.entryList(filter, QDir::Files | QDir::NoSymLinks);
+    QStringList layoutpaths;
 
     for (const auto &layout : files) {
         if (layout.contains(Layout::MULTIPLELAYOUTSHIDDENNAME)) {
@@ -541,9 +541,13 @@ void Synchronizer::initLayouts()
         }
 
         QString layoutpath = layoutDir.absolutePath() + "/" + layout;
+        layoutpaths << layoutpath;
         onLayoutAdded(layoutpath);
     }
 
+    m_layoutsIndex.prune(layoutpaths);
+    m_layoutsIndex.save();
+
     emit layoutsChanged();
 
     if (!m_isLoaded) {
@@ -555,8 +559,8 @@ void Synchronizer::initLayouts()
 
 void Synchronizer::onLayoutAdded(const QString &layout)
 {
-    CentralLayout centrallayout(this, layout);
-    m_layouts.insertBasedOnName(centrallayout.data());
+    //! layout files are parsed only when they are not indexed yet or they were changed
+    m_layouts.insertBasedOnName(m_layoutsIndex.layout(layout));
 
     if (m_isLoaded) {
         emit layoutsChanged();
@@ -21,6 +21,7 @@
 #define LAYOUTSSYNCHRONIZER_H
 
 // local
+#include "layoutsindex.h"
 #include "../apptypes.h"
 #include "../data/layoutdata.h"
 #include "../data/layoutstable.h"
@@ -167,6 +168,7 @@ private:
     bool m_isSingleLayoutInDeprecatedRenaming{false};
 
     Data::LayoutsTable m_layouts;
+    LayoutsIndex m_layoutsIndex;
     QList<CentralLayout *> m_centralLayouts;
     AssignedLayoutsHash m_assignedLayouts;
 
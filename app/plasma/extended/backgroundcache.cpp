@@ -23,11 +23,19 @@
 #include "../../tools/commontools.h"
 
 // Qt
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QDateTime>
 #include <QDebug>
+#include <QDir>
 #include <QFileInfo>
 #include <QImage>
+#include <QImageReader>
 #include <QList>
 #include <QRgb>
+#include <QRunnable>
+#include <QSaveFile>
+#include <QStandardPaths>
 #include <QtMath>
 
 // Plasma
@@ -39,17 +47,83 @@
 
 #define MAXHASHSIZE 300
 
+//! must be increased whenever the hints calculations or the file format are changed
+#define HINTSCACHEVERSION 1
+#define HINTSCACHEMAGIC 0x4C484E54
+#define HINTSCACHEFILE "lattedock/backgroundhints.cache"
+#define HINTSCACHESAVEINTERVAL 5000
+
+//! edge strips longer than this are downscaled during decoding
+#define MAXSTRIPLENGTH 1920
+//! 24px. should be enough because the views are always snapped to edges
+#define STRIPTHICKNESS 24
+
 #define PLASMACONFIG "plasma-org.kde.plasma.desktop-appletsrc"
 #define DEFAULTWALLPAPER "wallpapers/Next/contents/images/1920x1080.png"
 
 namespace Latte{
 namespace PlasmaExtended {
 
+//! calculates image hints for one image file edge in a worker thread
+//! and publishes them back to BackgroundCache through its event loop
+class ImageCalculationsJob : public QRunnable
+{
+public:
+    ImageCalculationsJob(BackgroundCache *cache, const QString &imageFile, Plasma::Types::Location location)
+        : m_cache(cache),
+          m_imageFile(imageFile),
+          m_location(location)
+    {
+    }
+
+    void run() override
+    {
+        //! file identity is read before decoding in order to not cache hints for a file that changed meanwhile
+        QFileInfo imageInfo(m_imageFile);
+        qint64 fileSize = imageInfo.size();
+        qint64 lastModified = imageInfo.lastModified().toMSecsSinceEpoch();
+
+        imageHints hints;
+        bool valid = BackgroundCache::calculateImageHints(m_imageFile, m_location, hints);
+
+        QMetaObject::invokeMethod(m_cache, "onImageCalculationsFinished", Qt::QueuedConnection,
+                                  Q_ARG(QString, m_imageFile),
+                                  Q_ARG(int, (int)m_location),
+                                  Q_ARG(qint64, fileSize),
+                                  Q_ARG(qint64, lastModified),
+                                  Q_ARG(bool, valid),
+                                  Q_ARG(bool, hints.busy),
+                                  Q_ARG(float, hints.brightness));
+    }
+
+private:
+    BackgroundCache *m_cache{nullptr};
+    QString m_imageFile;
+    Plasma::Types::Location m_location{Plasma::Types::BottomEdge};
+};
+
 BackgroundCache::BackgroundCache(QObject *parent)
     : QObject(parent),
       m_initialized(false),
+      m_calculationsPool(new QThreadPool(this)),
       m_plasmaConfig(KSharedConfig::openConfig(PLASMACONFIG))
 {
+    m_calculationsPool->setMaxThreadCount(2);
+
+    m_hintsCacheFile = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + QLatin1Char('/') + HINTSCACHEFILE;
+
+    m_hintsSaveTimer.setSingleShot(true);
+    m_hintsSaveTimer.setInterval(HINTSCACHESAVEINTERVAL);
+    connect(&m_hintsSaveTimer, &QTimer::timeout, this, &BackgroundCache::saveHintsCache);
+
+    //! the cache is a function static object that is destroyed after the application,
+    //! so any pending changes are written while the application is still alive
+    connect(qApp, &QCoreApplication::aboutToQuit, this, [&]() {
+        if (m_hintsCacheChanged) {
+            saveHintsCache();
+        }
+    });
+
     const auto configFile = QStandardPaths::writableLocation(
                 QStandardPaths::GenericConfigLocation) +
             QLatin1Char('/') + PLASMACONFIG;
@@ -67,11 +141,15 @@ BackgroundCache::BackgroundCache(QObject *parent)
         m_pool = new ScreenPool(this);
     }
 
+    loadHintsCache();
     reload();
 }
 
 BackgroundCache::~BackgroundCache()
-{   
+{
+    m_calculationsPool->clear();
+    m_calculationsPool->waitForDone();
+
     if (m_pool) {
         m_pool->deleteLater();
     }
@@ -219,30 +297,25 @@ float BackgroundCache::brightnessFor(QString activity, QString screen, Plasma::T
     return -1000;
 }
 
-float BackgroundCache::brightnessFromArea(QImage &image, int firstRow, int firstColumn, int endRow, int endColumn)
+float BackgroundCache::brightnessFromArea(const QImage &image, int firstRow, int firstColumn, int endRow, int endColumn)
 {
-    float areaBrightness = -1000;
-
-    if (image.format() != QImage::Format_Invalid) {
-        for (int row = firstRow; row < endRow; ++row) {
-            QRgb *line = (QRgb *)image.scanLine(row);
-
-            for (int col = firstColumn; col < endColumn ; ++col) {
-                QRgb pixelData = line[col];
-                float pixelBrightness = Latte::colorBrightness(pixelData);
+    if (image.format() == QImage::Format_Invalid || endRow <= firstRow || endColumn <= firstColumn) {
+        return -1000;
+    }
 
-                areaBrightness = (areaBrightness == -1000) ? pixelBrightness : (areaBrightness + pixelBrightness);
-            }
-        }
+    quint64 areaBrightnessSum{0};
 
-        float areaSize = (endRow - firstRow) * (endColumn - firstColumn);
-        areaBrightness = areaBrightness / areaSize;
+    for (int row = firstRow; row < endRow; ++row) {
+        const QRgb *line = (const QRgb *)image.constScanLine(row);
+        areaBrightnessSum += Latte::colorBrightnessSum(line + firstColumn, endColumn - firstColumn);
     }
 
-    return areaBrightness;
+    float areaSize = (endRow - firstRow) * (endColumn - firstColumn);
+
+    return ((double)areaBrightnessSum / 1000) / areaSize;
 }
 
-bool BackgroundCache::areaIsBusy(float bright1, float bright2) const
+bool BackgroundCache::areaIsBusy(float bright1, float bright2)
 {
     bool bright1IsLight = bright1>=123;
     bool bright2IsLight = bright2>=123;
@@ -252,6 +325,72 @@ bool BackgroundCache::areaIsBusy(float bright1, float bright2) const
     return !inBounds || bright1IsLight != bright2IsLight;
 }
 
+//! The image area at the edge that is needed for hints calculations. It is one pixel
+//! thicker than the tiles because the bottom/right tiles are skipping the last line
+QRect BackgroundCache::edgeStripRect(const QSize &imageSize, Plasma::Types::Location location)
+{
+    bool vertical = (location == Plasma::Types::LeftEdge || location == Plasma::Types::RightEdge) ? true : false;
+    int stripThickness = !vertical ? qMin(STRIPTHICKNESS+1, imageSize.height()) : qMin(STRIPTHICKNESS+1, imageSize.width());
+
+    if (location == Plasma::Types::BottomEdge) {
+        return QRect(0, imageSize.height() - stripThickness, imageSize.width(), stripThickness);
+    } else if (location == Plasma::Types::RightEdge) {
+        return QRect(imageSize.width() - stripThickness, 0, stripThickness, imageSize.height());
+    } else if (location == Plasma::Types::LeftEdge) {
+        return QRect(0, 0, stripThickness, imageSize.height());
+    }
+
+    return QRect(0, 0, imageSize.width(), stripThickness);
+}
+
+//! Only the edge strip that is needed is decoded and when the image handler supports it,
+//! it is also downscaled during decoding. The hints are averages so there is no need for
+//! the full wallpaper resolution. It is running in calculation workers so it must not touch
+//! any BackgroundCache members.
+QImage BackgroundCache::edgeStripFromFile(const QString &imageFile, Plasma::Types::Location location)
+{
+    bool vertical = (location == Plasma::Types::LeftEdge || location == Plasma::Types::RightEdge) ? true : false;
+
+    QImageReader reader(imageFile);
+
+    QImage strip;
+    QSize imageSize = reader.size();
+
+    if (imageSize.isValid()) {
+        QRect stripRect = edgeStripRect(imageSize, location);
+        int stripLength = !vertical ? stripRect.width() : stripRect.height();
+
+        reader.setClipRect(stripRect);
+
+        if (stripLength > MAXSTRIPLENGTH) {
+            reader.setScaledSize(!vertical ? QSize(MAXSTRIPLENGTH, stripRect.height()) : QSize(stripRect.width(), MAXSTRIPLENGTH));
+        }
+
+        strip = reader.read();
+    } else {
+        //! the image handler can not provide the image size without decoding,
+        //! in such case the entire image is decoded
+        QImage image = reader.read();
+
+        if (!image.isNull()) {
+            strip = image.copy(edgeStripRect(image.size(), location));
+        }
+    }
+
+    if (strip.isNull()) {
+        qDebug() << "Hints for Background image | Image could not be read:" << imageFile << reader.errorString();
+        return QImage();
+    }
+
+    if (strip.format() != QImage::Format_RGB32
+            && strip.format() != QImage::Format_ARGB32
+            && strip.format() != QImage::Format_ARGB32_Premultiplied) {
+        strip = strip.convertToFormat(QImage::Format_ARGB32);
+    }
+
+    return strip;
+}
+
 //! In order to calculate the brightness and busy hints for specific image
 //! the code is doing the following. It is not needed to calculate these values
 //! for the entire image that would also be cpu costly. The function takes
@@ -261,131 +400,203 @@ bool BackgroundCache::areaIsBusy(float bright1, float bright2) const
 //! area brightness. In order to indicate if this area is busy or not we
 //! compare the minimum and the maximum values of brightness from these
 //! tiles. If the difference it too big then the area is busy
-void BackgroundCache::updateImageCalculations(QString imageFile, Plasma::Types::Location location)
+bool BackgroundCache::calculateImageHints(const QString &imageFile, Plasma::Types::Location location, imageHints &hints)
 {
-    if (m_hintsCache.size() > MAXHASHSIZE) {
-        cleanupHashes();
-    }
+    QImage image = edgeStripFromFile(imageFile, location);
 
-    //! if it is a local image
-    QImage image(imageFile);
+    if (image.isNull()) {
+        return false;
+    }
 
-    if (image.format() != QImage::Format_Invalid) {
-        float brightness{-1000};
-        float maxBrightness{0};
-        float minBrightness{255};
+    float brightness{-1000};
+    float maxBrightness{0};
+    float minBrightness{255};
 
-        bool vertical = (location == Plasma::Types::LeftEdge || location == Plasma::Types::RightEdge) ? true : false;
-        int imageLength = !vertical ? image.width() : image.height();
-        int tiles{qMin(10,imageLength)};
+    bool vertical = (location == Plasma::Types::LeftEdge || location == Plasma::Types::RightEdge) ? true : false;
+    int imageLength = !vertical ? image.width() : image.height();
+    int tiles{qMin(10,imageLength)};
 
-        //! 24px. should be enough because the views are always snapped to edges
-        int tileThickness = !vertical ? qMin(24,image.height()) : qMin(24,image.width());
-        int tileLength = imageLength / tiles ;
+    //! 24px. should be enough because the views are always snapped to edges
+    int stripThickness = !vertical ? image.height() : image.width();
+    int tileThickness = qMin(STRIPTHICKNESS, stripThickness);
+    int tileLength = imageLength / tiles ;
 
-        int tileWidth = !vertical ? tileLength : tileThickness;
-        int tileHeight = !vertical ? tileThickness : tileLength;
+    int tileWidth = !vertical ? tileLength : tileThickness;
+    int tileHeight = !vertical ? tileThickness : tileLength;
 
-        float factor = ((float)100/tiles)/100;
+    float factor = ((float)100/tiles)/100;
 
-        QList<float> subBrightness;
+    QList<float> subBrightness;
 
-        qDebug() << "------------   -- Image Calculations --  --------------" ;
-        qDebug() << "Hints for Background image | " << imageFile;
-        qDebug() << "Hints for Background image | Edge: " << location << ", Image size: " << image.width() << "x" << image.height() << ", Tiles: " << tiles << ", subsize: " << tileWidth << "x" << tileHeight;
+    qDebug() << "------------   -- Image Calculations --  --------------" ;
+    qDebug() << "Hints for Background image | " << imageFile;
+    qDebug() << "Hints for Background image | Edge: " << location << ", Strip size: " << image.width() << "x" << image.height() << ", Tiles: " << tiles << ", subsize: " << tileWidth << "x" << tileHeight;
 
-        //! Iterating algorigthm
-        int firstRow = 0; int firstColumn = 0; int endRow = 0; int endColumn = 0;
+    //! Iterating algorigthm
+    int firstRow = 0; int firstColumn = 0; int endRow = 0; int endColumn = 0;
 
-        //! horizontal tiles calculations
-        if (location == Plasma::Types::TopEdge) {
-            firstRow = 0; endRow = tileThickness;
-        } else if (location == Plasma::Types::BottomEdge) {
-            firstRow = image.height() - tileThickness - 1; endRow = image.height() - 1;
-        }
+    //! horizontal tiles calculations
+    if (location == Plasma::Types::TopEdge) {
+        firstRow = 0; endRow = tileThickness;
+    } else if (location == Plasma::Types::BottomEdge) {
+        firstRow = qMax(0, stripThickness - tileThickness - 1); endRow = stripThickness - 1;
+    }
 
-        if (!vertical) {
-            for (int i=1; i<=tiles; ++i) {
-                float subFactor = ((float)i) * factor;
-                firstColumn = endColumn+1; endColumn = (subFactor*imageLength) - 1;
-                endColumn = qMin(endColumn, imageLength-1);
+    if (!vertical) {
+        for (int i=1; i<=tiles; ++i) {
+            float subFactor = ((float)i) * factor;
+            firstColumn = endColumn+1; endColumn = (subFactor*imageLength) - 1;
+            endColumn = qMin(endColumn, imageLength-1);
 
-                int tempBrightness = brightnessFromArea(image, firstRow, firstColumn, endRow, endColumn);
-                qDebug() << " Tile considering horizontal << (" << firstColumn << "," << firstRow << ") - (" << endColumn << "," << endRow << "), subfactor: " << subFactor
-                         << ", brightness: " << tempBrightness;
+            float tempBrightness = brightnessFromArea(image, firstRow, firstColumn, endRow, endColumn);
+            qDebug() << " Tile considering horizontal << (" << firstColumn << "," << firstRow << ") - (" << endColumn << "," << endRow << "), subfactor: " << subFactor
+                     << ", brightness: " << tempBrightness;
 
-                subBrightness.append(tempBrightness);
+            subBrightness.append(tempBrightness);
 
-                if (tempBrightness > maxBrightness) {
-                    maxBrightness = tempBrightness;
-                }
-                if (tempBrightness < minBrightness) {
-                    minBrightness = tempBrightness;
-                }
+            if (tempBrightness > maxBrightness) {
+                maxBrightness = tempBrightness;
+            }
+            if (tempBrightness < minBrightness) {
+                minBrightness = tempBrightness;
             }
         }
+    }
 
-        //! vertical tiles calculations
-        if (location == Plasma::Types::LeftEdge) {
-            firstColumn = 0; endColumn = tileThickness;
-        } else if (location == Plasma::Types::RightEdge) {
-            firstColumn = image.width() - 1 - tileThickness; endColumn = image.width() - 1;
-        }
+    //! vertical tiles calculations
+    if (location == Plasma::Types::LeftEdge) {
+        firstColumn = 0; endColumn = tileThickness;
+    } else if (location == Plasma::Types::RightEdge) {
+        firstColumn = qMax(0, stripThickness - 1 - tileThickness); endColumn = stripThickness - 1;
+    }
 
-        if (vertical) {
-            for (int i=1; i<=tiles; ++i) {
-                float subFactor = ((float)i) * factor;
-                firstRow = endRow+1; endRow = (subFactor*imageLength) - 1;
-                endRow = qMin(endRow, imageLength-1);
+    if (vertical) {
+        for (int i=1; i<=tiles; ++i) {
+            float subFactor = ((float)i) * factor;
+            firstRow = endRow+1; endRow = (subFactor*imageLength) - 1;
+            endRow = qMin(endRow, imageLength-1);
 
-                int tempBrightness = brightnessFromArea(image, firstRow, firstColumn, endRow, endColumn);
-                qDebug() << " Tile considering vertical << (" << firstColumn << "," << firstRow << ") - (" << endColumn << "," << endRow << "), subfactor: " << subFactor
-                         << ", brightness: " << tempBrightness;
+            float tempBrightness = brightnessFromArea(image, firstRow, firstColumn, endRow, endColumn);
+            qDebug() << " Tile considering vertical << (" << firstColumn << "," << firstRow << ") - (" << endColumn << "," << endRow << "), subfactor: " << subFactor
+                     << ", brightness: " << tempBrightness;
 
-                subBrightness.append(tempBrightness);
+            subBrightness.append(tempBrightness);
 
-                if (tempBrightness > maxBrightness) {
-                    maxBrightness = tempBrightness;
-                }
-                if (tempBrightness < minBrightness) {
-                    minBrightness = tempBrightness;
-                }
+            if (tempBrightness > maxBrightness) {
+                maxBrightness = tempBrightness;
+            }
+            if (tempBrightness < minBrightness) {
+                minBrightness = tempBrightness;
             }
         }
-        //! compute total brightness for this area
-        float subBrightnessSum = 0;
+    }
 
-        for (int i=0; i<subBrightness.count(); ++i) {
-            subBrightnessSum = subBrightnessSum + subBrightness[i];
-        }
+    //! compute total brightness for this area
+    float subBrightnessSum = 0;
 
-        brightness = subBrightnessSum / subBrightness.count();
+    for (int i=0; i<subBrightness.count(); ++i) {
+        subBrightnessSum = subBrightnessSum + subBrightness[i];
+    }
+
+    brightness = subBrightnessSum / subBrightness.count();
+
+    bool areaBusy = areaIsBusy(minBrightness, maxBrightness);
+
+    qDebug() << "Hints for Background image | Brightness: " << brightness << ", Busy: " << areaBusy << ", minBright:" << minBrightness << ", maxBright:" << maxBrightness;
+
+    hints.brightness = brightness;
+    hints.busy = areaBusy;
 
-        bool areaBusy = areaIsBusy(minBrightness, maxBrightness);
+    return true;
+}
 
-        qDebug() << "Hints for Background image | Brightness: " << brightness << ", Busy: " << areaBusy << ", minBright:" << minBrightness << ", maxBright:" << maxBrightness;
+void BackgroundCache::updateImageCalculations(QString imageFile, Plasma::Types::Location location)
+{
+    if (m_pendingCalculations.contains(imageFile) && m_pendingCalculations[imageFile].contains(location)) {
+        return;
+    }
 
-        if (!m_hintsCache.keys().contains(imageFile)) {
-            m_hintsCache[imageFile] = EdgesHash();
+    m_pendingCalculations[imageFile].append(location);
+    m_calculationsPool->start(new ImageCalculationsJob(this, imageFile, location));
+}
+
+void BackgroundCache::onImageCalculationsFinished(QString imageFile, int location, qint64 fileSize, qint64 lastModified, bool valid, bool busy, float brightness)
+{
+    Plasma::Types::Location edge = static_cast<Plasma::Types::Location>(location);
+
+    if (m_pendingCalculations.contains(imageFile)) {
+        m_pendingCalculations[imageFile].removeAll(edge);
+
+        if (m_pendingCalculations[imageFile].isEmpty()) {
+            m_pendingCalculations.remove(imageFile);
         }
+    }
 
-        if (!m_hintsCache[imageFile].contains(location)) {
-            imageHints iHints;
-            iHints.brightness = brightness; iHints.busy = areaBusy;
-            m_hintsCache[imageFile].insert(location, iHints);
-        } else {
-            m_hintsCache[imageFile][location].brightness = brightness;
-            m_hintsCache[imageFile][location].busy = areaBusy;
+    if (!valid) {
+        return;
+    }
+
+    imageCacheEntry &entry = m_hintsCache[imageFile];
+
+    if (entry.fileSize != fileSize || entry.lastModified != lastModified) {
+        //! the file was changed, hints from other edges are not valid any more
+        entry.edges.clear();
+        entry.fileSize = fileSize;
+        entry.lastModified = lastModified;
+    }
+
+    imageHints iHints;
+    iHints.brightness = brightness; iHints.busy = busy;
+    entry.edges.insert(edge, iHints);
+    entry.lastUsed = ++m_hintsUsageCounter;
+    entry.validated = true;
+
+    if (m_hintsCache.size() > MAXHASHSIZE) {
+        cleanupHashes();
+    }
+
+    scheduleHintsCacheSave();
+
+    emit hintsChanged(imageFile, location);
+}
+
+bool BackgroundCache::hintsAreCached(const QString &imageFile, Plasma::Types::Location location)
+{
+    if (!m_hintsCache.contains(imageFile)) {
+        return false;
+    }
+
+    imageCacheEntry &entry = m_hintsCache[imageFile];
+
+    if (!entry.validated) {
+        //! entries loaded from the persistent cache are validated the first time they are used
+        QFileInfo imageInfo(imageFile);
+
+        if (!imageInfo.exists()
+                || imageInfo.size() != entry.fileSize
+                || imageInfo.lastModified().toMSecsSinceEpoch() != entry.lastModified) {
+            m_hintsCache.remove(imageFile);
+            scheduleHintsCacheSave();
+            return false;
         }
+
+        entry.validated = true;
     }
+
+    if (!entry.edges.contains(location)) {
+        return false;
+    }
+
+    entry.lastUsed = ++m_hintsUsageCounter;
+    scheduleHintsCacheSave();
+
+    return true;
 }
 
 float BackgroundCache::brightnessForFile(QString imageFile, Plasma::Types::Location location)
 {
-    if (m_hintsCache.keys().contains(imageFile)) {
-        if (m_hintsCache[imageFile].keys().contains(location)) {
-            return m_hintsCache[imageFile][location].brightness;
-        }
+    if (hintsAreCached(imageFile, location)) {
+        return m_hintsCache[imageFile].edges[location].brightness;
     }
 
     //! if it is a color
@@ -393,21 +604,16 @@ float BackgroundCache::brightnessForFile(QString imageFile, Plasma::Types::Locat
         return Latte::colorBrightness(QColor(imageFile));
     }
 
+    //! hints are provided through hintsChanged() signal when calculations are finished
     updateImageCalculations(imageFile, location);
 
-    if (m_hintsCache.keys().contains(imageFile)) {
-        return m_hintsCache[imageFile][location].brightness;
-    }
-
     return -1000;
 }
 
 bool BackgroundCache::busyForFile(QString imageFile, Plasma::Types::Location location)
 {
-    if (m_hintsCache.keys().contains(imageFile)) {
-        if (m_hintsCache[imageFile].keys().contains(location)) {
-            return m_hintsCache[imageFile][location].busy;
-        }
+    if (hintsAreCached(imageFile, location)) {
+        return m_hintsCache[imageFile].edges[location].busy;
     }
 
     //! if it is a color
@@ -415,22 +621,124 @@ bool BackgroundCache::busyForFile(QString imageFile, Plasma::Types::Location loc
         return false;
     }
 
+    //! hints are provided through hintsChanged() signal when calculations are finished
     updateImageCalculations(imageFile, location);
 
-    if (m_hintsCache.keys().contains(imageFile)) {
-        return m_hintsCache[imageFile][location].busy;
-    }
-
     return false;
 }
 
 void BackgroundCache::cleanupHashes()
 {
-    if (m_hintsCache.count() <= MAXHASHSIZE) {
+    //! evict the least recently used image files
+    while (m_hintsCache.count() > MAXHASHSIZE) {
+        auto oldest = m_hintsCache.begin();
+
+        for (auto it = m_hintsCache.begin(); it != m_hintsCache.end(); ++it) {
+            if (it.value().lastUsed < oldest.value().lastUsed) {
+                oldest = it;
+            }
+        }
+
+        m_hintsCache.erase(oldest);
+        scheduleHintsCacheSave();
+    }
+}
+
+void BackgroundCache::loadHintsCache()
+{
+    QFile cacheFile(m_hintsCacheFile);
+
+    if (!cacheFile.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream in(&cacheFile);
+    in.setVersion(QDataStream::Qt_5_9);
+    in.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    quint32 magic{0};
+    quint32 version{0};
+    quint32 count{0};
+
+    in >> magic >> version >> count;
+
+    if (magic != HINTSCACHEMAGIC || version != HINTSCACHEVERSION) {
+        qDebug() << "Background hints cache is ignored because it is not compatible :: " << m_hintsCacheFile;
+        return;
+    }
+
+    QHash<QString, imageCacheEntry> loaded;
+
+    for (quint32 i=0; i<count && in.status() == QDataStream::Ok; ++i) {
+        QString imageFile;
+        imageCacheEntry entry;
+        quint32 edgesCount{0};
+
+        in >> imageFile >> entry.fileSize >> entry.lastModified >> entry.lastUsed >> edgesCount;
+
+        for (quint32 j=0; j<edgesCount && in.status() == QDataStream::Ok; ++j) {
+            qint32 location;
+            imageHints iHints;
+            in >> location >> iHints.busy >> iHints.brightness;
+            entry.edges.insert(static_cast<Plasma::Types::Location>(location), iHints);
+        }
+
+        loaded[imageFile] = entry;
+        m_hintsUsageCounter = qMax(m_hintsUsageCounter, entry.lastUsed);
+    }
+
+    if (in.status() != QDataStream::Ok) {
+        qDebug() << "Background hints cache is ignored because it is corrupted :: " << m_hintsCacheFile;
+        return;
+    }
+
+    m_hintsCache = loaded;
+    cleanupHashes();
+
+    qDebug() << "Background hints cache loaded :: " << m_hintsCache.count() << " image files";
+}
+
+void BackgroundCache::scheduleHintsCacheSave()
+{
+    m_hintsCacheChanged = true;
+
+    //! lookups change the usage order often, all changes are written with the next save
+    if (!m_hintsSaveTimer.isActive()) {
+        m_hintsSaveTimer.start();
+    }
+}
+
+void BackgroundCache::saveHintsCache()
+{
+    m_hintsSaveTimer.stop();
+
+    QDir().mkpath(QFileInfo(m_hintsCacheFile).absolutePath());
+
+    QSaveFile cacheFile(m_hintsCacheFile);
+
+    if (!cacheFile.open(QIODevice::WriteOnly)) {
+        qDebug() << "Background hints cache can not be written :: " << m_hintsCacheFile;
         return;
     }
 
-    m_hintsCache.clear();
+    QDataStream out(&cacheFile);
+    out.setVersion(QDataStream::Qt_5_9);
+    out.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    out << (quint32)HINTSCACHEMAGIC << (quint32)HINTSCACHEVERSION << (quint32)m_hintsCache.count();
+
+    for (auto it = m_hintsCache.constBegin(); it != m_hintsCache.constEnd(); ++it) {
+        const imageCacheEntry &entry = it.value();
+        out << it.key() << entry.fileSize << entry.lastModified << entry.lastUsed << (quint32)entry.edges.count();
+
+        for (auto edge = entry.edges.constBegin(); edge != entry.edges.constEnd(); ++edge) {
+            out << (qint32)edge.key() << edge.value().busy << edge.value().brightness;
+        }
+    }
+
+    if (cacheFile.commit()) {
+        m_hintsCacheChanged = false;
+    }
 }
 
 void BackgroundCache::setBackgroundFromBroadcast(QString activity, QString screen, QString filename)
@@ -25,7 +25,10 @@
 
 // Qt
 #include <QHash>
+#include <QImage>
 #include <QObject>
+#include <QThreadPool>
+#include <QTimer>
 
 // Plasma
 #include <Plasma>
@@ -41,6 +44,16 @@ struct imageHints {
 
 typedef QHash<Plasma::Types::Location, imageHints> EdgesHash;
 
+struct imageCacheEntry {
+    //! file size and modification time are used to validate persistent entries
+    qint64 fileSize{-1};
+    qint64 lastModified{-1};
+    //! least recently used entries are evicted first
+    quint64 lastUsed{0};
+    bool validated{false};
+    EdgesHash edges;
+};
+
 namespace Latte {
 namespace PlasmaExtended {
 
@@ -60,29 +73,44 @@ public:
     void setBackgroundFromBroadcast(QString activity, QString screen, QString filename);
     void setBroadcastedBackgroundsEnabled(QString activity, QString screen, bool enabled);
 
+    //! they are thread-safe and are used from the image calculations workers
+    static bool calculateImageHints(const QString &imageFile, Plasma::Types::Location location, imageHints &hints);
+    static float brightnessFromArea(const QImage &image, int firstRow, int firstColumn, int endRow, int endColumn);
+    static bool areaIsBusy(float bright1, float bright2);
+
 signals:
     void backgroundChanged(const QString &activity, const QString &screenName);
+    //! emitted when the brightness/busy hints of an image file were calculated
+    void hintsChanged(const QString &imageFile, int location);
 
 private slots:
     void reload();
     void settingsFileChanged(const QString &file);
 
+    void onImageCalculationsFinished(QString imageFile, int location, qint64 fileSize, qint64 lastModified, bool valid, bool busy, float brightness);
+
+    void loadHintsCache();
+    void saveHintsCache();
+
 private:
     BackgroundCache(QObject *parent = nullptr);
 
     bool backgroundIsBroadcasted(QString activity, QString screenName) const;
     bool pluginExistsFor(QString activity, QString screenName) const;
-    bool areaIsBusy(float bright1, float bright2) const;
     bool busyForFile(QString imageFile, Plasma::Types::Location location);
     bool isDesktopContainment(const KConfigGroup &containment) const;
+    bool hintsAreCached(const QString &imageFile, Plasma::Types::Location location);
+    void scheduleHintsCacheSave();
 
     float brightnessForFile(QString imageFile, Plasma::Types::Location location);
-    float brightnessFromArea(QImage &image, int firstRow, int firstColumn, int endRow, int endColumn);
     QString backgroundFromConfig(const KConfigGroup &config, QString wallpaperPlugin) const;
 
     void cleanupHashes();
     void updateImageCalculations(QString imageFile, Plasma::Types::Location location);
 
+    static QRect edgeStripRect(const QSize &imageSize, Plasma::Types::Location location);
+    static QImage edgeStripFromFile(const QString &imageFile, Plasma::Types::Location location);
+
 private:
     bool m_initialized{false};
 
@@ -100,8 +128,22 @@ private:
     //! and have higher priority: activity id, screen names
     QHash<QString, QList<QString>> m_broadcasted;
 
+    bool m_hintsCacheChanged{false};
+    quint64 m_hintsUsageCounter{0};
+
+    //! persistent file for image hints, it is loaded at startup
+    QString m_hintsCacheFile;
+    //! avoid writing the hints cache file for each calculation
+    QTimer m_hintsSaveTimer;
+
     //! image file and brightness per edge
-    QHash<QString, EdgesHash> m_hintsCache;
+    QHash<QString, imageCacheEntry> m_hintsCache;
+
+    //! image file and edges whose calculations are currently running in workers
+    QHash<QString, QList<Plasma::Types::Location>> m_pendingCalculations;
+
+    //! image calculations are decoding wallpapers and must not block the event loop
+    QThreadPool *m_calculationsPool{nullptr};
 
     KSharedConfig::Ptr m_plasmaConfig;
 };
@@ -33,6 +33,7 @@ BackgroundTracker::BackgroundTracker(QObject *parent)
     connect(this, &BackgroundTracker::screenNameChanged, this, &BackgroundTracker::update);
 
     connect(PlasmaExtended::BackgroundCache::self(), &PlasmaExtended::BackgroundCache::backgroundChanged, this, &BackgroundTracker::backgroundChanged);
+    connect(PlasmaExtended::BackgroundCache::self(), &PlasmaExtended::BackgroundCache::hintsChanged, this, &BackgroundTracker::hintsChanged);
 }
 
 BackgroundTracker::~BackgroundTracker()
@@ -106,6 +107,17 @@ void BackgroundTracker::backgroundChanged(const QString &activity, const QString
     }
 }
 
+void BackgroundTracker::hintsChanged(const QString &imageFile, int location)
+{
+    if (m_activity.isEmpty() || m_screenName.isEmpty() || m_location != location) {
+        return;
+    }
+
+    if (PlasmaExtended::BackgroundCache::self()->background(m_activity, m_screenName) == imageFile) {
+        update();
+    }
+}
+
 void BackgroundTracker::update()
 {
     if (m_activity.isEmpty() || m_screenName.isEmpty()) {
@@ -68,6 +68,7 @@ signals:
 
 private slots:
     void backgroundChanged(const QString &activity, const QString &screenName);
+    void hintsChanged(const QString &imageFile, int location);
     void update();
 
 private:
@@ -35,6 +35,7 @@
 #define LATTESERVICE "org.kde.lattedock"
 #define PLASMASERVICE "org.kde.plasmashell"
 #define PLASMASTRUTNAMESPACE "org.kde.PlasmaShell.StrutManager"
+#define PLASMASTRUTPATH "/StrutManager"
 
 #define PUBLISHINTERVAL 1000
 
@@ -65,9 +66,22 @@ ScreenGeometries::~ScreenGeometries()
 
 void ScreenGeometries::init()
 {
-    QDBusInterface plasmaStrutsIface(PLASMASERVICE, "/StrutManager", PLASMASTRUTNAMESPACE, QDBusConnection::sessionBus());
+    //! introspection is not blocking, plasma may be slow to respond during startup
+    QDBusMessage message = QDBusMessage::createMethodCall(PLASMASERVICE,
+                                                          PLASMASTRUTPATH,
+                                                          "org.freedesktop.DBus.Introspectable",
+                                                          "Introspect");
+
+    auto watcher = new QDBusPendingCallWatcher(QDBusConnection::sessionBus().asyncCall(message), this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, &ScreenGeometries::onPlasmaIntrospected);
+}
+
+void ScreenGeometries::onPlasmaIntrospected(QDBusPendingCallWatcher *call)
+{
+    QDBusPendingReply<QString> reply = *call;
+    call->deleteLater();
 
-    if (plasmaStrutsIface.isValid()) {
+    if (!reply.isError() && reply.value().contains(PLASMASTRUTNAMESPACE)) {
         m_plasmaInterfaceAvailable = true;
 
         qDebug() << " PLASMA STRUTS MANAGER :: is available...";
@@ -105,12 +119,6 @@ void ScreenGeometries::updateGeometries()
         return;
     }
 
-    QDBusInterface plasmaStrutsIface(PLASMASERVICE, "/StrutManager", PLASMASTRUTNAMESPACE, QDBusConnection::sessionBus());
-
-    if (!plasmaStrutsIface.isValid()) {
-        return;
-    }
-
     QStringList availableScreenNames;
 
     qDebug() << " PLASMA SCREEN GEOMETRIES, LAST AVAILABLE SCREEN RECTS :: " << m_lastAvailableRect;
@@ -142,20 +150,16 @@ void ScreenGeometries::updateGeometries()
             //! is using a different layout. When the user from Unity is switching to
             //! Music and afterwards to Canvas the desktop elements are not positioned properly
             if (m_forceGeometryBroadcast) {
-                plasmaStrutsIface.call("setAvailableScreenRect", LATTESERVICE, scrName, QRect());
+                setAvailableScreenRect(scrName, QRect());
             }
 
             //! Disable checks because of the workaround concerning plasma desktop behavior
             if (m_forceGeometryBroadcast || (!m_lastAvailableRect.contains(scrName) || m_lastAvailableRect[scrName] != availableRect)) {
                 m_lastAvailableRect[scrName] = availableRect;
-                plasmaStrutsIface.call("setAvailableScreenRect", LATTESERVICE, scrName, availableRect);
+                setAvailableScreenRect(scrName, availableRect);
                 qDebug() << " PLASMA SCREEN GEOMETRIES, AVAILABLE RECT :: " << screen->name() << " : " << availableRect;
             }
 
-            if (m_forceGeometryBroadcast) {
-                m_forceGeometryBroadcast = false;
-            }
-
             if (!m_lastAvailableRegion.contains(scrName) || m_lastAvailableRegion[scrName] != availableRegion) {
                 m_lastAvailableRegion[scrName] = availableRegion;
 
@@ -165,7 +169,7 @@ void ScreenGeometries::updateGeometries()
                     rects << rect;
                 }
 
-                plasmaStrutsIface.call("setAvailableScreenRegion", LATTESERVICE, scrName, QVariant::fromValue(rects));
+                setAvailableScreenRegion(scrName, rects);
                 qDebug() << " PLASMA SCREEN GEOMETRIES, AVAILABLE REGION :: " << screen->name() << " : " << availableRegion;
             }
         }
@@ -173,12 +177,14 @@ void ScreenGeometries::updateGeometries()
         availableScreenNames << scrName;
     }
 
+    m_forceGeometryBroadcast = false;
+
     //! check for inactive screens that were published previously
     for (QString &lastScrName : m_lastScreenNames) {
         if (!screenIsActive(lastScrName)) {
             //! screen became inactive and its geometries could be unpublished
-            plasmaStrutsIface.call("setAvailableScreenRect", LATTESERVICE, lastScrName, QRect());
-            plasmaStrutsIface.call("setAvailableScreenRegion", LATTESERVICE, lastScrName, QVariant::fromValue(QList<QRect>()));
+            setAvailableScreenRect(lastScrName, QRect());
+            setAvailableScreenRegion(lastScrName, QList<QRect>());
 
             m_lastAvailableRect.remove(lastScrName);
             m_lastAvailableRegion.remove(lastScrName);
@@ -187,6 +193,51 @@ void ScreenGeometries::updateGeometries()
     }
 
     m_lastScreenNames = availableScreenNames;
+
+    sendPendingMessages();
+}
+
+void ScreenGeometries::setAvailableScreenRect(const QString &screenName, const QRect &rect)
+{
+    QDBusMessage message = QDBusMessage::createMethodCall(PLASMASERVICE, PLASMASTRUTPATH, PLASMASTRUTNAMESPACE, "setAvailableScreenRect");
+    message.setArguments({QString(LATTESERVICE), screenName, QVariant::fromValue(rect)});
+
+    m_pendingMessages << message;
+}
+
+void ScreenGeometries::setAvailableScreenRegion(const QString &screenName, const QList<QRect> &rects)
+{
+    QDBusMessage message = QDBusMessage::createMethodCall(PLASMASERVICE, PLASMASTRUTPATH, PLASMASTRUTNAMESPACE, "setAvailableScreenRegion");
+    message.setArguments({QString(LATTESERVICE), screenName, QVariant::fromValue(rects)});
+
+    m_pendingMessages << message;
+}
+
+void ScreenGeometries::sendPendingMessages()
+{
+    for (const auto &message : m_pendingMessages) {
+        const QString method = message.member();
+        const QString screenName = message.arguments()[1].toString();
+
+        auto watcher = new QDBusPendingCallWatcher(QDBusConnection::sessionBus().asyncCall(message), this);
+
+        connect(watcher, &QDBusPendingCallWatcher::finished, this, [&, method, screenName](QDBusPendingCallWatcher *call) {
+            if (call->isError()) {
+                qDebug() << " PLASMA SCREEN GEOMETRIES, FAILED TO PUBLISH :: " << method << " : " << screenName << " : " << call->error().message();
+
+                //! publish it again at the next update cycle
+                if (method == QLatin1String("setAvailableScreenRect")) {
+                    m_lastAvailableRect.remove(screenName);
+                } else {
+                    m_lastAvailableRegion.remove(screenName);
+                }
+            }
+
+            call->deleteLater();
+        });
+    }
+
+    m_pendingMessages.clear();
 }
 
 void ScreenGeometries::availableScreenGeometryChangedFrom(Latte::View *origin)
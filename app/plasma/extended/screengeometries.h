@@ -25,6 +25,8 @@
 #include <coretypes.h>
 
 // Qt
+#include <QDBusMessage>
+#include <QDBusPendingCallWatcher>
 #include <QHash>
 #include <QObject>
 #include <QTimer>
@@ -50,11 +52,18 @@ private slots:
     void availableScreenGeometryChangedFrom(Latte::View *origin);
 
     void init();
+    void onPlasmaIntrospected(QDBusPendingCallWatcher *call);
     void updateGeometries();
 
 private slots:
     bool screenIsActive(const QString &screenName) const;
 
+private:
+    void setAvailableScreenRect(const QString &screenName, const QRect &rect);
+    void setAvailableScreenRegion(const QString &screenName, const QList<QRect> &rects);
+    //! all messages of an update cycle are sent together and are not waiting for plasma to respond
+    void sendPendingMessages();
+
 private:
     bool m_plasmaInterfaceAvailable{false};
     bool m_forceGeometryBroadcast{false};
@@ -77,6 +86,8 @@ private:
 
     QHash<QString, QRect> m_lastAvailableRect;
     QHash<QString, QRegion> m_lastAvailableRegion;
+
+    QList<QDBusMessage> m_pendingMessages;
 };
 
 }
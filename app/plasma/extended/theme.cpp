@@ -31,8 +31,9 @@
 // Qt
 #include <QDebug>
 #include <QDir>
-#include <QPainter>
 #include <QProcess>
+#include <QtMath>
+#include <QVector>
 
 // KDE
 #include <KDirWatch>
@@ -421,65 +422,53 @@ const CornerRegions &Theme::cornersMask(const int &radius)
         return m_cornerRegions[radius];
     }
 
-    qDebug() << radius;
-    CornerRegions corners;
-
-    int axis = (2 * radius) + 2;
-    QImage cornerimage(axis, axis, QImage::Format_ARGB32);
-    QPainter painter(&cornerimage);
-    //!does not provide valid masks
-    //painter.setRenderHints(QPainter::Antialiasing);
-
-    QPen pen(Qt::black);
-    pen.setStyle(Qt::SolidLine);
-    pen.setWidth(1);
-    painter.setPen(pen);
-
-    QRect rectArea(0,0,axis,axis);
-    painter.fillRect(rectArea, Qt::white);
-    painter.drawRoundedRect(rectArea, axis, axis);
+    //! the corners are calculated from the circle that is inscribed in a (2*radius+2) square,
+    //! for each row the pixels whose center is outside the circle are masked out
+    const qreal circleRadius = radius + 1;
+    QVector<int> widths;
 
-    QRegion topleft;
     for(int y=0; y<radius; ++y) {
-        QRgb *line = (QRgb *)cornerimage.scanLine(y);
-
-        QString bits;
-        int width{0};
-        for(int x=0; x<radius; ++x) {
-            QRgb point = line[x];
-
-            if (QColor(point) == Qt::black) {
-                bits = bits + "1 ";
-                width = qMax(0, x);
-                break;
-            } else {
-                bits = bits + "0 ";
-            }
-        }
+        const qreal dy = circleRadius - (y + 0.5);
+        const qreal edge = circleRadius - qSqrt(circleRadius*circleRadius - dy*dy);
+        const int width = qCeil(edge - 0.5);
 
-        if (width>0) {
-            topleft += QRect(0, y, width, 1);
+        if (width <= 0) {
+            break;
         }
 
-        qDebug()<< "  " << bits;
+        widths << width;
     }
-    corners.topLeft = topleft;
 
-    QTransform transform;
-    transform.rotate(90);
-    corners.topRight = transform.map(corners.topLeft);
-    corners.topRight.translate(corners.topLeft.boundingRect().width(), 0);
+    CornerRegions corners;
 
-    corners.bottomRight = transform.map(corners.topRight);
-    corners.bottomRight.translate(corners.topLeft.boundingRect().width(), 0);
+    if (widths.isEmpty()) {
+        m_cornerRegions[radius] = corners;
+        return m_cornerRegions[radius];
+    }
+
+    const int cornerwidth = widths[0];
+    const int cornerheight = widths.count();
 
-    corners.bottomLeft = transform.map(corners.bottomRight);
-    corners.bottomLeft.translate(corners.topLeft.boundingRect().width(), 0);
+    QVector<QRect> topleft;
+    QVector<QRect> topright;
+    QVector<QRect> bottomleft;
+    QVector<QRect> bottomright;
+
+    for(int y=0; y<cornerheight; ++y) {
+        const int width = widths[y];
+        const int mirroredwidth = widths[cornerheight - 1 - y];
+
+        topleft << QRect(0, y, width, 1);
+        topright << QRect(cornerwidth - width, y, width, 1);
+        bottomleft << QRect(0, y, mirroredwidth, 1);
+        bottomright << QRect(cornerwidth - mirroredwidth, y, mirroredwidth, 1);
+    }
 
-    //qDebug() << " reg top;: " << corners.topLeft;
-    //qDebug() << " reg topr: " << corners.topRight;
-    //qDebug() << " reg bottomr: " << corners.bottomRight;
-    //qDebug() << " reg bottoml: " << corners.bottomLeft;
+    //! rows are already sorted and do not overlap, so they can be set directly
+    corners.topLeft.setRects(topleft.constData(), topleft.count());
+    corners.topRight.setRects(topright.constData(), topright.count());
+    corners.bottomLeft.setRects(bottomleft.constData(), bottomleft.count());
+    corners.bottomRight.setRects(bottomright.constData(), bottomright.count());
 
     m_cornerRegions[radius] = corners;
     return m_cornerRegions[radius];
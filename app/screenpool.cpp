@@ -45,6 +45,7 @@ ScreenPool::ScreenPool(KSharedConfig::Ptr config, QObject *parent)
     : QObject(parent),
       m_configGroup(KConfigGroup(config, QStringLiteral("ScreenConnectors")))
 {
+    updateRandrEventBase();
     qApp->installNativeEventFilter(this);
 
     m_configSaveTimer.setSingleShot(true);
@@ -327,6 +328,23 @@ QScreen *ScreenPool::screenForId(int id)
     return screen;
 }
 
+void ScreenPool::updateRandrEventBase()
+{
+    m_randrScreenChangeEvent = 0;
+
+#if HAVE_X11
+    if (!QX11Info::isPlatformX11() || !QX11Info::connection()) {
+        return;
+    }
+
+    const xcb_query_extension_reply_t *reply = xcb_get_extension_data(QX11Info::connection(), &xcb_randr_id);
+
+    if (reply && reply->present) {
+        m_randrScreenChangeEvent = reply->first_event + XCB_RANDR_SCREEN_CHANGE_NOTIFY;
+    }
+#endif
+}
+
 bool ScreenPool::nativeEventFilter(const QByteArray &eventType, void *message, long int *result)
 {
     Q_UNUSED(result);
@@ -336,17 +354,13 @@ bool ScreenPool::nativeEventFilter(const QByteArray &eventType, void *message, l
     // we don't have any signal about it, the primary screen changes but we have the same old QScreen* getting recycled
     // see https://bugs.kde.org/show_bug.cgi?id=373880
     // if this slot will be invoked many times, their//second time on will do nothing as name and primaryconnector will be the same by then
-    if (eventType != "xcb_generic_event_t") {
+    if (m_randrScreenChangeEvent == 0 || eventType != "xcb_generic_event_t") {
         return false;
     }
 
     xcb_generic_event_t *ev = static_cast<xcb_generic_event_t *>(message);
 
-    const auto responseType = XCB_EVENT_RESPONSE_TYPE(ev);
-
-    const xcb_query_extension_reply_t *reply = xcb_get_extension_data(QX11Info::connection(), &xcb_randr_id);
-
-    if (responseType == reply->first_event + XCB_RANDR_SCREEN_CHANGE_NOTIFY) {
+    if (XCB_EVENT_RESPONSE_TYPE(ev) == m_randrScreenChangeEvent) {
         if (qGuiApp->primaryScreen()->name() != m_lastPrimaryConnector) {
             //new screen?
             if (id(qGuiApp->primaryScreen()->name()) < 0) {
@@ -76,6 +76,7 @@ private slots:
 
 private:
     void save();
+    void updateRandrEventBase();
     void updateScreenGeometry(const int &screenId, const QRect &screenGeometry);
 
 private:
@@ -85,6 +86,10 @@ private:
     //! used to workaround a bug under X11 when primary screen changes and no screenChanged signal is emitted
     QString m_lastPrimaryConnector;
 
+    //! resolved once because the native event filter is called for every X11 event,
+    //! zero means that no RandR events are tracked
+    quint8 m_randrScreenChangeEvent{0};
+
     QTimer m_configSaveTimer;
 };
 
@@ -27,6 +27,116 @@
 #include <QStringList>
 #include <QtMath>
 
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define LATTE_BRIGHTNESS_SIMD
+#include <immintrin.h>
+#endif
+
+//! the lanes of simd accumulators are 32bit and can hold up to 4096 pixels
+//! of maximum weighted brightness (255 * 1000) before they are flushed
+#define BRIGHTNESSLANEPIXELS 4096
+
+namespace {
+
+typedef quint64 (*BrightnessSumFunction)(const QRgb *, int);
+
+quint64 colorBrightnessSumScalar(const QRgb *pixels, int count)
+{
+    quint64 sum{0};
+
+    for (int i=0; i<count; ++i) {
+        sum += qRed(pixels[i]) * 299 + qGreen(pixels[i]) * 587 + qBlue(pixels[i]) * 114;
+    }
+
+    return sum;
+}
+
+#if defined(LATTE_BRIGHTNESS_SIMD)
+//! Each 32bit pixel is split in two groups of 16bit lanes, [blue, red] and [green, alpha],
+//! so that a single multiply-add provides the weighted channels for each pixel
+__attribute__((target("sse2")))
+quint64 colorBrightnessSumSse2(const QRgb *pixels, int count)
+{
+    const __m128i mask = _mm_set1_epi32(0x00FF00FF);
+    const __m128i weightsBR = _mm_set1_epi32((299 << 16) | 114);
+    const __m128i weightsGA = _mm_set1_epi32(587);
+
+    quint64 sum{0};
+    int i{0};
+
+    while (count - i >= 4) {
+        const int blockEnd = i + qMin((count - i) & ~3, 4 * BRIGHTNESSLANEPIXELS);
+        __m128i accumulator = _mm_setzero_si128();
+
+        for (; i < blockEnd; i += 4) {
+            const __m128i pixel = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels + i));
+            const __m128i br = _mm_and_si128(pixel, mask);
+            const __m128i ga = _mm_and_si128(_mm_srli_epi32(pixel, 8), mask);
+
+            accumulator = _mm_add_epi32(accumulator, _mm_madd_epi16(br, weightsBR));
+            accumulator = _mm_add_epi32(accumulator, _mm_madd_epi16(ga, weightsGA));
+        }
+
+        quint32 lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), accumulator);
+        sum += (quint64)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+
+    return sum + colorBrightnessSumScalar(pixels + i, count - i);
+}
+
+__attribute__((target("avx2")))
+quint64 colorBrightnessSumAvx2(const QRgb *pixels, int count)
+{
+    const __m256i mask = _mm256_set1_epi32(0x00FF00FF);
+    const __m256i weightsBR = _mm256_set1_epi32((299 << 16) | 114);
+    const __m256i weightsGA = _mm256_set1_epi32(587);
+
+    quint64 sum{0};
+    int i{0};
+
+    while (count - i >= 8) {
+        const int blockEnd = i + qMin((count - i) & ~7, 8 * BRIGHTNESSLANEPIXELS);
+        __m256i accumulator = _mm256_setzero_si256();
+
+        for (; i < blockEnd; i += 8) {
+            const __m256i pixel = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pixels + i));
+            const __m256i br = _mm256_and_si256(pixel, mask);
+            const __m256i ga = _mm256_and_si256(_mm256_srli_epi32(pixel, 8), mask);
+
+            accumulator = _mm256_add_epi32(accumulator, _mm256_madd_epi16(br, weightsBR));
+            accumulator = _mm256_add_epi32(accumulator, _mm256_madd_epi16(ga, weightsGA));
+        }
+
+        quint32 lanes[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), accumulator);
+
+        for (int j=0; j<8; ++j) {
+            sum += lanes[j];
+        }
+    }
+
+    return sum + colorBrightnessSumScalar(pixels + i, count - i);
+}
+#endif
+
+BrightnessSumFunction selectBrightnessSumFunction()
+{
+#if defined(LATTE_BRIGHTNESS_SIMD)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+        return colorBrightnessSumAvx2;
+    } else if (__builtin_cpu_supports("sse2")) {
+        return colorBrightnessSumSse2;
+    }
+#endif
+
+    return colorBrightnessSumScalar;
+}
+
+}
+
 namespace Latte {
 
 float colorBrightness(QColor color)
@@ -46,6 +156,14 @@ float colorBrightness(float r, float g, float b)
     return brightness;
 }
 
+quint64 colorBrightnessSum(const QRgb *pixels, int count)
+{
+    //! the best implementation for the running cpu is selected only once
+    static const BrightnessSumFunction brightnessSum = selectBrightnessSumFunction();
+
+    return brightnessSum(pixels, count);
+}
+
 
 float colorLumina(QRgb rgb)
 {
@@ -32,6 +32,10 @@ float colorBrightness(QColor color);
 float colorBrightness(QRgb rgb);
 float colorBrightness(float r, float g, float b);
 
+//! sum of colorBrightness() for all pixels multiplied by 1000,
+//! it is vectorized when the running cpu supports it
+quint64 colorBrightnessSum(const QRgb *pixels, int count);
+
 float colorLumina(QColor color);
 float colorLumina(QRgb rgb);
 float colorLumina(float r, float g, float b);
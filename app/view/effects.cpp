@@ -382,34 +382,41 @@ void Effects::removeUnitedMaskRegion(const QString &regionid)
 
 QRegion Effects::customMask(const QRect &rect)
 {
+    const int corners = (m_hasTopLeftCorner ? 1 : 0)
+            | (m_hasTopRightCorner ? 2 : 0)
+            | (m_hasBottomRightCorner ? 4 : 0)
+            | (m_hasBottomLeftCorner ? 8 : 0);
+
+    //! animations request the same mask continuously
+    if (m_customMaskIsValid && m_customMaskRect == rect && m_customMaskCorners == corners) {
+        return m_customMask;
+    }
+
     QRegion result = rect;
     int dx = rect.right() - m_cornersMaskRegion.topLeft.boundingRect().width() + 1;
     int dy = rect.bottom() - m_cornersMaskRegion.topLeft.boundingRect().height() + 1;
 
     if (m_hasTopLeftCorner) {
-        QRegion tl = m_cornersMaskRegion.topLeft;
-        tl.translate(rect.x(), rect.y());
-        result = result.subtracted(tl);
+        result = result.subtracted(m_cornersMaskRegion.topLeft.translated(rect.x(), rect.y()));
     }
 
     if (m_hasTopRightCorner) {
-        QRegion tr = m_cornersMaskRegion.topRight;
-        tr.translate(rect.x() + dx, rect.y());
-        result = result.subtracted(tr);
+        result = result.subtracted(m_cornersMaskRegion.topRight.translated(rect.x() + dx, rect.y()));
     }
 
     if (m_hasBottomRightCorner) {
-        QRegion br = m_cornersMaskRegion.bottomRight;
-        br.translate(rect.x() + dx, rect.y() + dy);
-        result = result.subtracted(br);
+        result = result.subtracted(m_cornersMaskRegion.bottomRight.translated(rect.x() + dx, rect.y() + dy));
     }
 
     if (m_hasBottomLeftCorner) {
-        QRegion bl = m_cornersMaskRegion.bottomLeft;
-        bl.translate(rect.x(), rect.y() + dy);
-        result = result.subtracted(bl);
+        result = result.subtracted(m_cornersMaskRegion.bottomLeft.translated(rect.x(), rect.y() + dy));
     }
 
+    m_customMask = result;
+    m_customMaskRect = rect;
+    m_customMaskCorners = corners;
+    m_customMaskIsValid = true;
+
     return result;
 }
 
@@ -434,9 +441,8 @@ void Effects::updateBackgroundCorners()
         return;
     }
 
-    m_corona->themeExtended()->cornersMask(m_backgroundRadius);
-
     m_cornersMaskRegion = m_corona->themeExtended()->cornersMask(m_backgroundRadius);
+    m_customMaskIsValid = false;
     emit backgroundCornersMaskChanged();
 }
 
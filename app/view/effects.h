@@ -166,6 +166,10 @@ private:
     bool m_hasBottomLeftCorner{false};
     bool m_hasBottomRightCorner{false};
 
+    //! memoized custom mask, it is recalculated only when its inputs change
+    bool m_customMaskIsValid{false};
+    int m_customMaskCorners{0};
+
     int m_editShadow{0};
     int m_innerShadow{0};
 
@@ -185,6 +189,9 @@ private:
 
     PlasmaExtended::CornerRegions m_cornersMaskRegion;
 
+    QRect m_customMaskRect;
+    QRegion m_customMask;
+
     Plasma::Theme m_theme;
     //only for the mask on disabled compositing, not to actually paint
     Plasma::FrameSvg *m_background{nullptr};
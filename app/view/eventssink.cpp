@@ -77,17 +77,18 @@ void EventsSink::release()
     setSink(nullptr, nullptr);
 }
 
-QEvent *EventsSink::onEvent(QEvent *e)
+bool EventsSink::onEvent(QEvent *e, const std::function<bool (QEvent *)> &deliver)
 {
     if (!e) {
-        return nullptr;
+        return false;
     }
 
     if (!isActive()) {
-        return e;
+        return deliver(e);
     }
 
-    QEvent *sunkevent = e;
+    //! sunk events are created on the stack and are delivered immediately, this way
+    //! no allocations are needed for high rate events such as mouse and drag moves
 
     switch (e->type()) {
     case QEvent::Leave:
@@ -97,12 +98,12 @@ QEvent *EventsSink::onEvent(QEvent *e)
         if (auto de = static_cast<QDragEnterEvent *>(e)) {
             QPointF point = de->posF();
             if (originSinksContain(point)) {
-                auto de2 = new QDragEnterEvent(positionAdjustedForDestination(point).toPoint(),
-                                               de->possibleActions(),
-                                               de->mimeData(),
-                                               de->mouseButtons(),
-                                               de->keyboardModifiers());
-                sunkevent = de2;
+                QDragEnterEvent de2(positionAdjustedForDestination(point).toPoint(),
+                                    de->possibleActions(),
+                                    de->mimeData(),
+                                    de->mouseButtons(),
+                                    de->keyboardModifiers());
+                return deliver(&de2);
             } else if (!destinationContains(point)) {
                 release();
             }
@@ -113,13 +114,12 @@ QEvent *EventsSink::onEvent(QEvent *e)
         if (auto de = static_cast<QDragMoveEvent *>(e)) {
             QPointF point = de->posF();
             if (originSinksContain(point)) {
-                auto de2 = new QDragMoveEvent(positionAdjustedForDestination(point).toPoint(),
-                                              de->possibleActions(),
-                                              de->mimeData(),
-                                              de->mouseButtons(),
-                                              de->keyboardModifiers());
-
-                sunkevent = de2;
+                QDragMoveEvent de2(positionAdjustedForDestination(point).toPoint(),
+                                   de->possibleActions(),
+                                   de->mimeData(),
+                                   de->mouseButtons(),
+                                   de->keyboardModifiers());
+                return deliver(&de2);
             } else if (!destinationContains(point)) {
                 release();
             }
@@ -130,13 +130,12 @@ QEvent *EventsSink::onEvent(QEvent *e)
         if (auto de = static_cast<QDropEvent *>(e)) {
             QPointF point = de->posF();
             if (originSinksContain(point)) {
-                auto de2 = new QDropEvent(positionAdjustedForDestination(point).toPoint(),
-                                          de->possibleActions(),
-                                          de->mimeData(),
-                                          de->mouseButtons(),
-                                          de->keyboardModifiers());
-
-                sunkevent = de2;
+                QDropEvent de2(positionAdjustedForDestination(point).toPoint(),
+                               de->possibleActions(),
+                               de->mimeData(),
+                               de->mouseButtons(),
+                               de->keyboardModifiers());
+                return deliver(&de2);
             } else if (!destinationContains(point)) {
                 release();
             }
@@ -148,13 +147,12 @@ QEvent *EventsSink::onEvent(QEvent *e)
         if (auto me = dynamic_cast<QMouseEvent *>(e)) {
             if (m_view->positioner() && m_view->positioner()->isCursorInsideView() && originSinksContain(me->windowPos())) {
                 auto positionadjusted = positionAdjustedForDestination(me->windowPos());
-                auto me2 = new QMouseEvent(me->type(),
-                                           positionadjusted,
-                                           positionadjusted,
-                                           positionadjusted + m_view->position(),
-                                           me->button(), me->buttons(), me->modifiers());
-
-                sunkevent = me2;
+                QMouseEvent me2(me->type(),
+                                positionadjusted,
+                                positionadjusted,
+                                positionadjusted + m_view->position(),
+                                me->button(), me->buttons(), me->modifiers());
+                return deliver(&me2);
             } else if (!destinationContains(me->windowPos())) {
                 release();
             }
@@ -165,14 +163,14 @@ QEvent *EventsSink::onEvent(QEvent *e)
         if (auto me = dynamic_cast<QMouseEvent *>(e)) {
             if (originSinksContain(me->windowPos())) {
                 auto positionadjusted = positionAdjustedForDestination(me->windowPos());
-                auto me2 = new QMouseEvent(me->type(),
-                                           positionadjusted,
-                                           positionadjusted,
-                                           positionadjusted + m_view->position(),
-                                           me->button(), me->buttons(), me->modifiers());
+                QMouseEvent me2(me->type(),
+                                positionadjusted,
+                                positionadjusted,
+                                positionadjusted + m_view->position(),
+                                me->button(), me->buttons(), me->modifiers());
 
                 qDebug() << "Sunk Event:: sunk event pressed...";
-                sunkevent = me2;
+                return deliver(&me2);
             } else if (!destinationContains(me->windowPos())) {
                 release();
             }
@@ -183,13 +181,12 @@ QEvent *EventsSink::onEvent(QEvent *e)
         if (auto me = dynamic_cast<QMouseEvent *>(e)) {
             if (originSinksContain(me->windowPos())) {
                 auto positionadjusted = positionAdjustedForDestination(me->windowPos());
-                auto me2 = new QMouseEvent(me->type(),
-                                           positionadjusted,
-                                           positionadjusted,
-                                           positionadjusted + m_view->position(),
-                                           me->button(), me->buttons(), me->modifiers());
-
-                sunkevent = me2;
+                QMouseEvent me2(me->type(),
+                                positionadjusted,
+                                positionadjusted,
+                                positionadjusted + m_view->position(),
+                                me->button(), me->buttons(), me->modifiers());
+                return deliver(&me2);
             } else if (!destinationContains(me->windowPos())) {
                 release();
             }
@@ -206,12 +203,11 @@ QEvent *EventsSink::onEvent(QEvent *e)
 
             if (originSinksContain(pos)) {
                 auto positionadjusted = positionAdjustedForDestination(pos);
-                auto we2 = new QWheelEvent(positionadjusted,
-                                           positionadjusted + m_view->position(),
-                                           we->pixelDelta(), we->angleDelta(), we->angleDelta().y(),
-                                           we->orientation(), we->buttons(), we->modifiers(), we->phase());
-
-                sunkevent = we2;
+                QWheelEvent we2(positionadjusted,
+                                positionadjusted + m_view->position(),
+                                we->pixelDelta(), we->angleDelta(), we->angleDelta().y(),
+                                we->orientation(), we->buttons(), we->modifiers(), we->phase());
+                return deliver(&we2);
             } else if (!destinationContains(pos)) {
                 release();
             }
@@ -221,7 +217,7 @@ QEvent *EventsSink::onEvent(QEvent *e)
         break;
     }
 
-    return sunkevent;
+    return deliver(e);
 }
 
 QPointF EventsSink::positionAdjustedForDestination(const QPointF &point) const
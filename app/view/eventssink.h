@@ -20,6 +20,9 @@
 #ifndef VIEWEVENTSSINK_H
 #define VIEWEVENTSSINK_H
 
+// C++
+#include <functional>
+
 // Qt
 #include <QEvent>
 #include <QObject>
@@ -55,11 +58,12 @@ public:
     QQuickItem *originParentItem() const;
     QQuickItem *destinationItem() const;
 
+    //! the sunk event or the original one when it is not sunk is passed to deliver
+    bool onEvent(QEvent *e, const std::function<bool (QEvent *)> &deliver);
+
 public slots:
     Q_INVOKABLE void setSink(QQuickItem *originParent, QQuickItem *destination);
 
-    QEvent *onEvent(QEvent *e);
-
 signals:
     void itemsChanged();
 
@@ -17,7 +17,9 @@
 */
 
 #include "panelshadows_p.h"
+#include "../debug.h"
 
+#include <QElapsedTimer>
 #include <QWindow>
 #include <QPainter>
 
@@ -30,6 +32,11 @@
 #include <X11/Xlib.h>
 #include <X11/Xlib-xcb.h>
 #include <fixx11h.h>
+#if HAVE_XCB_SHM
+#include <xcb/shm.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#endif
 #endif
 
 #include <KWayland/Client/connection_thread.h>
@@ -66,6 +73,11 @@ public:
     void clearPixmaps();
     void setupPixmaps();
     Qt::HANDLE createPixmap(const QPixmap& source);
+    void uploadPendingImages();
+#if HAVE_XCB_SHM
+    bool shmIsAvailable();
+    void putImagesShm();
+#endif
     void initPixmap(const QString &element);
     QPixmap initEmptyPixmap(const QSize &size);
     void updateShadow(const QWindow *window, Plasma::FrameSvg::EnabledBorders);
@@ -98,6 +110,24 @@ public:
     //! graphical context
     xcb_gcontext_t _gc;
     bool m_isX11;
+
+#if HAVE_XCB_SHM
+    //! -1: not checked yet, 0: MIT-SHM is not supported, 1: MIT-SHM is supported
+    int m_shmSupport{-1};
+    bool m_lastUploadThroughShm{false};
+#endif
+    //! pixmaps that were created but their image is not sent yet, they are sent
+    //! together through uploadPendingImages()
+    struct PendingUpload {
+        xcb_pixmap_t pixmap;
+        QImage image;
+    };
+    QList<PendingUpload> m_pendingUploads;
+
+    //! uploaded X11 pixmaps based on their source QPixmap::cacheKey(), they
+    //! are shared between all enabled borders combinations
+    QHash<qint64, unsigned long> m_x11Pixmaps;
+    int m_uploadsCount{0};
 #endif
 
     struct Wayland {
@@ -229,6 +259,11 @@ Qt::HANDLE PanelShadows::Private::createPixmap(const QPixmap& source)
         return nullptr;
     }
 
+    //! the same tiles are used from many enabled borders combinations
+    if (m_x11Pixmaps.contains(source.cacheKey())) {
+        return reinterpret_cast<Qt::HANDLE>(m_x11Pixmaps[source.cacheKey()]);
+    }
+
     // check connection
     if( !_connection ) _connection = QX11Info::connection();
 
@@ -245,24 +280,10 @@ Qt::HANDLE PanelShadows::Private::createPixmap(const QPixmap& source)
         xcb_create_gc( _connection, _gc, pixmap, 0, nullptr );
     }
 
-//         // create explicitly shared QPixmap from it
-//         QPixmap dest( QPixmap::fromX11Pixmap( pixmap, QPixmap::ExplicitlyShared ) );
-//
-//         // create surface for pixmap
-//         {
-//             QPainter painter( &dest );
-//             painter.setCompositionMode( QPainter::CompositionMode_Source );
-//             painter.drawPixmap( 0, 0, source );
-//         }
-//
-//
-//         return pixmap;
-    QImage image( source.toImage() );
-    xcb_put_image(
-        _connection, XCB_IMAGE_FORMAT_Z_PIXMAP, pixmap, _gc,
-        image.width(), image.height(), 0, 0,
-        0, 32,
-        image.byteCount(), image.constBits());
+    m_pendingUploads << PendingUpload{static_cast<xcb_pixmap_t>(pixmap), source.toImage()};
+
+    m_x11Pixmaps[source.cacheKey()] = pixmap;
+    m_uploadsCount++;
 
     return (Qt::HANDLE)pixmap;
 
@@ -272,6 +293,129 @@ Qt::HANDLE PanelShadows::Private::createPixmap(const QPixmap& source)
 
 }
 
+void PanelShadows::Private::uploadPendingImages()
+{
+#if HAVE_X11
+#if HAVE_XCB_SHM
+    m_lastUploadThroughShm = false;
+    putImagesShm();
+#endif
+
+    //! images that were not sent through MIT-SHM
+    for (const auto &upload : m_pendingUploads) {
+        xcb_put_image(
+            _connection, XCB_IMAGE_FORMAT_Z_PIXMAP, upload.pixmap, _gc,
+            upload.image.width(), upload.image.height(), 0, 0,
+            0, 32,
+            upload.image.byteCount(), upload.image.constBits());
+    }
+
+    m_pendingUploads.clear();
+#endif
+}
+
+#if HAVE_XCB_SHM
+bool PanelShadows::Private::shmIsAvailable()
+{
+    if (m_shmSupport < 0) {
+        const xcb_query_extension_reply_t *extension = xcb_get_extension_data(_connection, &xcb_shm_id);
+        m_shmSupport = 0;
+
+        if (extension && extension->present) {
+            xcb_shm_query_version_reply_t *version = xcb_shm_query_version_reply(_connection, xcb_shm_query_version(_connection), nullptr);
+
+            if (version) {
+                m_shmSupport = 1;
+                free(version);
+            }
+        }
+    }
+
+    return (m_shmSupport == 1);
+}
+
+void PanelShadows::Private::putImagesShm()
+{
+    //! all pending images share one segment and their errors are checked together,
+    //! so they cost a single round trip. Small uploads are cheaper through
+    //! xcb_put_image that needs no round trip at all.
+    const int SHMMINIMUMBYTES = 64 * 1024;
+
+    int totalBytes{0};
+
+    for (const auto &upload : m_pendingUploads) {
+        totalBytes += upload.image.byteCount();
+    }
+
+    if (totalBytes < SHMMINIMUMBYTES || !shmIsAvailable()) {
+        return;
+    }
+
+    const int shmid = shmget(IPC_PRIVATE, totalBytes, IPC_CREAT | 0600);
+
+    if (shmid < 0) {
+        return;
+    }
+
+    void *address = shmat(shmid, nullptr, 0);
+
+    if (address == reinterpret_cast<void *>(-1)) {
+        shmctl(shmid, IPC_RMID, nullptr);
+        return;
+    }
+
+    const xcb_shm_seg_t segment = xcb_generate_id(_connection);
+    const xcb_void_cookie_t attachCookie = xcb_shm_attach_checked(_connection, segment, shmid, 0);
+
+    QVector<xcb_void_cookie_t> putCookies;
+    putCookies.reserve(m_pendingUploads.count());
+    int offset{0};
+
+    for (const auto &upload : m_pendingUploads) {
+        memcpy(static_cast<char *>(address) + offset, upload.image.constBits(), upload.image.byteCount());
+
+        putCookies << xcb_shm_put_image_checked(_connection, upload.pixmap, _gc,
+                                                upload.image.width(), upload.image.height(), 0, 0,
+                                                upload.image.width(), upload.image.height(), 0, 0,
+                                                32, XCB_IMAGE_FORMAT_Z_PIXMAP, 0,
+                                                segment, offset);
+
+        offset += upload.image.byteCount();
+    }
+
+    //! the first check waits for the server once, the rest are already answered
+    xcb_generic_error_t *error = xcb_request_check(_connection, attachCookie);
+    const bool attached = !error;
+
+    if (error) {
+        free(error);
+        m_shmSupport = 0;
+    }
+
+    QList<PendingUpload> failedUploads;
+
+    for (int i=0; i<putCookies.count(); ++i) {
+        error = xcb_request_check(_connection, putCookies[i]);
+
+        if (error || !attached) {
+            failedUploads << m_pendingUploads[i];
+        }
+
+        free(error);
+    }
+
+    if (attached) {
+        xcb_shm_detach(_connection, segment);
+    }
+
+    shmdt(address);
+    shmctl(shmid, IPC_RMID, nullptr);
+
+    m_lastUploadThroughShm = (failedUploads.count() < m_pendingUploads.count());
+    m_pendingUploads = failedUploads;
+}
+#endif
+
 void PanelShadows::Private::initPixmap(const QString &element)
 {
     m_shadowPixmaps << q->pixmap(element);
@@ -328,6 +472,11 @@ void PanelShadows::Private::setupData(Plasma::FrameSvg::EnabledBorders enabledBo
     if (!m_isX11) {
         return;
     }
+
+    QElapsedTimer uploadTimer;
+    uploadTimer.start();
+    const int previousUploads = m_uploadsCount;
+
     //shadow-top
     if (enabledBorders & Plasma::FrameSvg::TopBorder) {
         data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_shadowPixmaps[0]));
@@ -403,6 +552,17 @@ void PanelShadows::Private::setupData(Plasma::FrameSvg::EnabledBorders enabledBo
     } else {
         data[enabledBorders] << reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerPix));
     }
+
+    uploadPendingImages();
+
+#if HAVE_XCB_SHM
+    const bool throughShm = m_lastUploadThroughShm;
+#else
+    const bool throughShm = false;
+#endif
+
+    qCDebug(LATTE_PERFORMANCE) << "Panel shadows for borders" << enabledBorders << "uploaded" << (m_uploadsCount - previousUploads)
+                               << "pixmaps in" << uploadTimer.nsecsElapsed() / 1000 << "us" << (throughShm ? "through MIT-SHM" : "");
 #endif
 
     int left, top, right, bottom = 0;
@@ -467,33 +627,12 @@ void PanelShadows::Private::freeX11Pixmaps()
         return;
     }
 
-    foreach (const QPixmap &pixmap, m_shadowPixmaps) {
-        if (!pixmap.isNull()) {
-            XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(pixmap)));
-        }
+    for (const auto pixmap : m_x11Pixmaps) {
+        XFreePixmap(display, pixmap);
     }
 
-    if (!m_emptyCornerPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerPix)));
-    }
-    if (!m_emptyCornerBottomPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerBottomPix)));
-    }
-    if (!m_emptyCornerLeftPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerLeftPix)));
-    }
-    if (!m_emptyCornerRightPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerRightPix)));
-    }
-    if (!m_emptyCornerTopPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyCornerTopPix)));
-    }
-    if (!m_emptyVerticalPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyVerticalPix)));
-    }
-    if (!m_emptyHorizontalPix.isNull()) {
-        XFreePixmap(display, reinterpret_cast<unsigned long>(createPixmap(m_emptyHorizontalPix)));
-    }
+    m_x11Pixmaps.clear();
+    m_pendingUploads.clear();
 #endif
 }
 
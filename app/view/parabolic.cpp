@@ -21,8 +21,10 @@
 
 // local
 #include "view.h"
+#include "../debug.h"
 
 // Qt
+#include <QDebug>
 #include <QMetaObject>
 
 namespace Latte {
@@ -48,6 +50,7 @@ Parabolic::Parabolic(Latte::View *parent)
 
 Parabolic::~Parabolic()
 {
+    qCDebug(LATTE_PERFORMANCE) << "parabolic moves delivered:" << m_deliveredParabolicMoves << "dropped:" << m_droppedParabolicMoves;
 }
 
 QQuickItem *Parabolic::currentParabolicItem() const
@@ -66,6 +69,11 @@ void Parabolic::setCurrentParabolicItem(QQuickItem *item)
     }
 
     m_currentParabolicItem = item;
+
+    //! a move that is still queued for the previous item is dropped
+    m_hasPendingParabolicMove = false;
+    m_parabolicItemChanges++;
+
     emit currentParabolicItemChanged();
 }
 
@@ -78,29 +86,12 @@ void Parabolic::onEvent(QEvent *e)
     switch (e->type()) {
 
     case QEvent::Leave:
+        m_hasPendingParabolicMove = false;
         setCurrentParabolicItem(nullptr);
         break;
     case QEvent::MouseMove:
         if (auto me = dynamic_cast<QMouseEvent *>(e)) {
-            if (m_currentParabolicItem) {
-                QPointF internal = m_currentParabolicItem->mapFromScene(me->windowPos());
-
-                if (m_currentParabolicItem->contains(internal)) {
-                    m_parabolicItemNullifier.stop();
-                    //! sending move event to parabolic item
-                    QMetaObject::invokeMethod(m_currentParabolicItem,
-                                              "parabolicMove",
-                                              Qt::QueuedConnection,
-                                              Q_ARG(qreal, internal.x()),
-                                              Q_ARG(qreal, internal.y()));
-                } else {
-                    m_lastOrphanParabolicMove = me->windowPos();
-                    //! clearing parabolic item
-                    m_parabolicItemNullifier.start();
-                }
-            } else {
-                m_lastOrphanParabolicMove = me->windowPos();
-            }
+            scheduleParabolicMove(me->windowPos());
         }
     default:
         break;
@@ -108,6 +99,64 @@ void Parabolic::onEvent(QEvent *e)
 
 }
 
+void Parabolic::scheduleParabolicMove(const QPointF &windowPos)
+{
+    if (!m_currentParabolicItem) {
+        //! must be always up-to-date for the next parabolic item
+        m_lastOrphanParabolicMove = windowPos;
+        return;
+    }
+
+    m_pendingParabolicMove = windowPos;
+
+    if (m_hasPendingParabolicMove) {
+        //! a newer position replaces the one that was not sent yet
+        m_droppedParabolicMoves++;
+        return;
+    }
+
+    //! the first move is queued right away and the moves that arrive before it is
+    //! delivered only update its position. It is queued after any parabolicEntered
+    //! of the current item, so that order is kept
+    m_hasPendingParabolicMove = true;
+    QMetaObject::invokeMethod(this, "sendPendingParabolicMove", Qt::QueuedConnection, Q_ARG(uint, m_parabolicItemChanges));
+}
+
+void Parabolic::sendPendingParabolicMove(uint itemChanges)
+{
+    if (itemChanges != m_parabolicItemChanges || !m_hasPendingParabolicMove) {
+        return;
+    }
+
+    m_hasPendingParabolicMove = false;
+    m_deliveredParabolicMoves++;
+    sendParabolicMove(m_pendingParabolicMove);
+}
+
+void Parabolic::sendParabolicMove(const QPointF &windowPos)
+{
+    if (m_currentParabolicItem) {
+        QPointF internal = m_currentParabolicItem->mapFromScene(windowPos);
+
+        if (m_currentParabolicItem->contains(internal)) {
+            m_parabolicItemNullifier.stop();
+            //! sending move event to parabolic item, it is already called from a queued
+            //! delivery that follows the queued parabolicEntered of the same item
+            QMetaObject::invokeMethod(m_currentParabolicItem,
+                                      "parabolicMove",
+                                      Qt::DirectConnection,
+                                      Q_ARG(qreal, internal.x()),
+                                      Q_ARG(qreal, internal.y()));
+        } else {
+            m_lastOrphanParabolicMove = windowPos;
+            //! clearing parabolic item
+            m_parabolicItemNullifier.start();
+        }
+    } else {
+        m_lastOrphanParabolicMove = windowPos;
+    }
+}
+
 void Parabolic::onCurrentParabolicItemChanged()
 {
     m_parabolicItemNullifier.stop();
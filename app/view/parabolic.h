@@ -54,8 +54,23 @@ signals:
 private slots:
     void onCurrentParabolicItemChanged();
     void onEvent(QEvent *e);
+    void sendPendingParabolicMove(uint itemChanges);
 
 private:
+    void scheduleParabolicMove(const QPointF &windowPos);
+    void sendParabolicMove(const QPointF &windowPos);
+
+private:
+    //! mouse moves are coalesced while a queued delivery is pending and only the
+    //! latest one is sent. Deliveries that were queued for a previous parabolic item
+    //! are recognized through m_parabolicItemChanges
+    bool m_hasPendingParabolicMove{false};
+    uint m_parabolicItemChanges{0};
+    QPointF m_pendingParabolicMove;
+
+    quint64 m_deliveredParabolicMoves{0};
+    quint64 m_droppedParabolicMoves{0};
+
     QPointer<Latte::View> m_view;
     QPointer<QQuickItem> m_currentParabolicItem;
 
@@ -144,6 +144,12 @@ View::View(Plasma::Corona *corona, QScreen *targetScreen, bool byPassWM)
         if (!m_visibility) {
             m_visibility = new ViewPart::VisibilityManager(this);
 
+            connect(m_visibility, &ViewPart::VisibilityManager::modeChanged, this, [&]() {
+                if (m_corona) {
+                    m_corona->invalidateAvailableScreenGeometries();
+                }
+            });
+
             connect(m_visibility, &ViewPart::VisibilityManager::isHiddenChanged, this, [&]() {
                 if (m_visibility->isHidden()) {
                     m_interface->deactivateApplets();
@@ -207,6 +213,10 @@ View::~View()
 {
     m_inDelete = true;
 
+    if (m_corona) {
+        m_corona->invalidateAvailableScreenGeometries();
+    }
+
     //! clear Layout connections
     m_visibleHackTimer1.stop();
     m_visibleHackTimer2.stop();
@@ -299,6 +309,29 @@ void View::init(Plasma::Containment *plasma_containment)
     connect(m_corona, &Latte::Corona::availableScreenRectChangedFrom, this, &View::availableScreenRectChangedFromSlot);
     connect(m_corona, &Latte::Corona::verticalUnityViewHasFocus, this, &View::topViewAlwaysOnTop);
 
+    //! properties that are used in corona available screen geometries calculations
+    auto invalidateAvailableScreenGeometries = [&]() {
+        if (m_corona) {
+            m_corona->invalidateAvailableScreenGeometries();
+        }
+    };
+
+    connect(this, &QWindow::xChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &QWindow::yChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &QWindow::widthChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &QWindow::heightChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &QWindow::screenChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &View::activitiesChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &View::alignmentChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &View::behaveAsPlasmaPanelChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &View::containmentChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &View::layoutChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &View::locationChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &View::maxLengthChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &View::normalThicknessChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &View::offsetChanged, this, invalidateAvailableScreenGeometries);
+    connect(this, &View::screenEdgeMarginChanged, this, invalidateAvailableScreenGeometries);
+
     connect(this, &View::byPassWMChanged, this, &View::saveConfig);
     connect(this, &View::isPreferredForShortcutsChanged, this, &View::saveConfig);
     connect(this, &View::onPrimaryChanged, this, &View::saveConfig);
@@ -1354,8 +1387,6 @@ void View::setInterfacesGraphicObj(Latte::Interfaces *ifaces)
 
 bool View::event(QEvent *e)
 {   
-    QEvent *sunkevent = e;
-
     if (!m_inDelete) {
         emit eventTriggered(e);
 
@@ -1459,11 +1490,13 @@ bool View::event(QEvent *e)
         }
 
         if (sinkableevent && m_sink->isActive()) {
-            sunkevent = m_sink->onEvent(e);
+            return m_sink->onEvent(e, [this](QEvent *sunkevent) {
+                return ContainmentView::event(sunkevent);
+            });
         }
     }
 
-    return ContainmentView::event(sunkevent);
+    return ContainmentView::event(e);
 }
 
 void View::releaseConfigView()
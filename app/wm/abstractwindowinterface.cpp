@@ -48,14 +48,15 @@ AbstractWindowInterface::AbstractWindowInterface(QObject *parent)
     m_schemesTracker = new Tracker::Schemes(this);
 
     rulesConfig = KSharedConfig::openConfig(QStringLiteral("taskmanagerrulesrc"));
+    m_appIdentityCache = new AppIdentityCache(this);
 
     m_windowWaitingTimer.setInterval(150);
     m_windowWaitingTimer.setSingleShot(true);
 
     connect(&m_windowWaitingTimer, &QTimer::timeout, this, [&]() {
-        WindowId wid = m_windowChangedWaiting;
-        m_windowChangedWaiting = QVariant();
-        emit windowChanged(wid);
+        QList<WindowId> wids = m_windowsChangedWaiting;
+        m_windowsChangedWaiting.clear();
+        emit windowsChanged(wids);
     });
 
     connect(this, &AbstractWindowInterface::windowRemoved, this, &AbstractWindowInterface::windowRemovedSlot);
@@ -79,6 +80,17 @@ AbstractWindowInterface::~AbstractWindowInterface()
     m_windowsTracker->deleteLater();
 }
 
+QList<WindowInfoWrap> AbstractWindowInterface::requestInfos(const QList<WindowId> &wids)
+{
+    QList<WindowInfoWrap> infos;
+
+    for (const auto &wid : wids) {
+        infos << requestInfo(wid);
+    }
+
+    return infos;
+}
+
 QString AbstractWindowInterface::currentDesktop()
 {
     return m_currentDesktop;
@@ -249,6 +261,8 @@ void AbstractWindowInterface::unregisterWhitelistedWindow(WindowId wid)
 
 void AbstractWindowInterface::windowRemovedSlot(WindowId wid)
 {
+    m_windowsChangedWaiting.removeAll(wid);
+
     if (m_plasmaIgnoredWindows.contains(wid)) {
         unregisterPlasmaIgnoredWindow(wid);
     }
@@ -302,27 +316,13 @@ void AbstractWindowInterface::switchToPreviousActivity()
 //! Delay window changed trigerring
 void AbstractWindowInterface::considerWindowChanged(WindowId wid)
 {
-    //! Consider if the windowChanged signal should be sent DIRECTLY or WAIT
-
-    if (m_windowChangedWaiting == wid && m_windowWaitingTimer.isActive()) {
-        //! window should be sent later
-        m_windowWaitingTimer.start();
-        return;
+    //! Windows are queued and sent all together when the timer ticks, the timer is not
+    //! restarted for upcoming changes so windows are never waiting more than one tick
+    if (!m_windowsChangedWaiting.contains(wid)) {
+        m_windowsChangedWaiting.append(wid);
     }
 
-    if (m_windowChangedWaiting != wid && !m_windowWaitingTimer.isActive()) {
-        //! window should be sent later
-        m_windowChangedWaiting = wid;
-        m_windowWaitingTimer.start();
-    }
-
-    if (m_windowChangedWaiting != wid && m_windowWaitingTimer.isActive()) {
-        m_windowWaitingTimer.stop();
-        //! sent previous waiting window
-        emit windowChanged(m_windowChangedWaiting);
-
-        //! retrigger waiting for the upcoming window
-        m_windowChangedWaiting = wid;
+    if (!m_windowWaitingTimer.isActive()) {
         m_windowWaitingTimer.start();
     }
 }
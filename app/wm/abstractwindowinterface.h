@@ -23,6 +23,7 @@
 
 // local
 #include <coretypes.h>
+#include "appidentitycache.h"
 #include "schemecolors.h"
 #include "tasktools.h"
 #include "windowinfowrap.h"
@@ -91,6 +92,8 @@ public:
     virtual WindowId activeWindow() = 0;
     virtual WindowInfoWrap requestInfo(WindowId wid) = 0;
     virtual WindowInfoWrap requestInfoActive() = 0;
+    //! infos are provided in the same order as the windows ids
+    virtual QList<WindowInfoWrap> requestInfos(const QList<WindowId> &wids);
 
     virtual void skipTaskBar(const QDialog &dialog) = 0;
     virtual void slideWindow(QWindow &view, Slide location) = 0;
@@ -147,6 +150,8 @@ public:
 signals:
     void activeWindowChanged(WindowId wid);
     void windowChanged(WindowId winfo);
+    //! coalesced changes of many windows that were changed during the same tick
+    void windowsChanged(const QList<WindowId> &wids);
     void windowAdded(WindowId wid);
     void windowRemoved(WindowId wid);
     void currentDesktopChanged();
@@ -170,13 +175,15 @@ protected:
     QPointer<KActivities::Consumer> m_activities;
 
     //! Sending too fast plenty of signals for the same window
-    //! has no reason and can create HIGH CPU usage. This Timer
-    //! can delay the batch sending of signals for the same window
-    WindowId m_windowChangedWaiting;
+    //! has no reason and can create HIGH CPU usage. Changed windows
+    //! are queued and they are sent all together once per timer tick
+    QList<WindowId> m_windowsChangedWaiting;
     QTimer m_windowWaitingTimer;
 
     //! Plasma taskmanager rules ile
     KSharedConfig::Ptr rulesConfig;
+    //! resolved applications of windows
+    AppIdentityCache *m_appIdentityCache{nullptr};
 
     void considerWindowChanged(WindowId wid);
 
@@ -0,0 +1,295 @@
+/*
+*  Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "appidentitycache.h"
+#include <config-latte.h>
+
+// local
+#include "../tools/commontools.h"
+
+// Qt
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+// KDE
+#include <KConfigGroup>
+#include <KDirWatch>
+#include <KSycoca>
+
+//! must be increased whenever the url resolution or the file format are changed
+#define APPIDENTITYCACHEVERSION 3
+#define APPIDENTITYCACHEMAGIC 0x4C415050
+#define APPIDENTITYCACHEFILE "lattedock/appidentities.cache"
+#define APPIDENTITYCACHESAVEINTERVAL 5000
+#define MAXCACHEDAPPIDENTITIES 500
+
+namespace Latte {
+namespace WindowSystem {
+
+AppIdentityCache::AppIdentityCache(QObject *parent)
+    : QObject(parent)
+{
+    m_cacheFile = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + QLatin1Char('/') + APPIDENTITYCACHEFILE;
+    m_rulesFile = Latte::configPath() + "/taskmanagerrulesrc";
+
+    m_saveTimer.setSingleShot(true);
+    m_saveTimer.setInterval(APPIDENTITYCACHESAVEINTERVAL);
+    connect(&m_saveTimer, &QTimer::timeout, this, &AppIdentityCache::saveCache);
+
+#if KF5_VERSION_MINOR >= 80
+    connect(KSycoca::self(), static_cast<void (KSycoca::*)()>(&KSycoca::databaseChanged), this, &AppIdentityCache::clear);
+#else
+    connect(KSycoca::self(), static_cast<void (KSycoca::*)(const QStringList &)>(&KSycoca::databaseChanged), this, &AppIdentityCache::clear);
+#endif
+
+    //! urls are resolved also through the mapping and rewrite rules of taskmanagerrulesrc
+    KDirWatch::self()->addFile(m_rulesFile);
+    connect(KDirWatch::self(), &KDirWatch::dirty, this, &AppIdentityCache::onRulesFileChanged);
+    connect(KDirWatch::self(), &KDirWatch::created, this, &AppIdentityCache::onRulesFileChanged);
+    connect(KDirWatch::self(), &KDirWatch::deleted, this, &AppIdentityCache::onRulesFileChanged);
+
+    loadCache();
+}
+
+AppIdentityCache::~AppIdentityCache()
+{
+    if (m_cacheChanged) {
+        saveCache();
+    }
+}
+
+void AppIdentityCache::clear()
+{
+    m_urls.clear();
+    m_appData.clear();
+    m_cacheChanged = true;
+    m_saveTimer.start();
+}
+
+void AppIdentityCache::onRulesFileChanged(const QString &path)
+{
+    if (path != m_rulesFile) {
+        return;
+    }
+
+    m_rulesChanged = true;
+    clear();
+}
+
+qint64 AppIdentityCache::sycocaTimestamp() const
+{
+    return QFileInfo(KSycoca::absoluteFilePath()).lastModified().toMSecsSinceEpoch();
+}
+
+qint64 AppIdentityCache::rulesTimestamp() const
+{
+    QFileInfo rulesInfo(m_rulesFile);
+
+    return rulesInfo.exists() ? rulesInfo.lastModified().toMSecsSinceEpoch() : 0;
+}
+
+QString AppIdentityCache::processExecutable(quint32 pid) const
+{
+    if (pid == 0) {
+        return QString();
+    }
+
+    //! a single readlink, much cheaper than gathering the full process information
+    return QFileInfo(QStringLiteral("/proc/%1/exe").arg(pid)).symLinkTarget();
+}
+
+QString AppIdentityCache::processIdentity(quint32 pid, KSharedConfig::Ptr rulesConfig) const
+{
+    if (pid == 0 || !rulesConfig) {
+        return processExecutable(pid);
+    }
+
+    QFile cmdLineFile(QStringLiteral("/proc/%1/cmdline").arg(pid));
+
+    if (!cmdLineFile.open(QIODevice::ReadOnly)) {
+        return processExecutable(pid);
+    }
+
+    const QStringList arguments = QString::fromLocal8Bit(cmdLineFile.readAll()).split(QLatin1Char('\0'), QString::SkipEmptyParts);
+
+    if (arguments.isEmpty()) {
+        return processExecutable(pid);
+    }
+
+    //! servicesFromCmdLine() skips runtimes such as python or java and resolves the application
+    //! from their arguments, so different scripts of the same runtime must not share their url
+    KConfigGroup set(rulesConfig, "Settings");
+    const QStringList &runtimes = set.readEntry("TryIgnoreRuntimes", QStringList());
+    const QString &program = arguments.first();
+
+    if (runtimes.contains(program) || runtimes.contains(program.mid(program.lastIndexOf(QLatin1Char('/')) + 1))) {
+        return arguments.join(QLatin1Char(' '));
+    }
+
+    return processExecutable(pid);
+}
+
+QUrl AppIdentityCache::windowUrl(const QString &appId, quint32 pid, KSharedConfig::Ptr rulesConfig, const QString &xWindowsWMClassName)
+{
+    if (m_rulesChanged && rulesConfig) {
+        rulesConfig->reparseConfiguration();
+        m_rulesChanged = false;
+    }
+
+    const QString key = appId + QLatin1Char('\n') + xWindowsWMClassName + QLatin1Char('\n') + processIdentity(pid, rulesConfig);
+
+    auto cached = m_urls.constFind(key);
+
+    if (cached != m_urls.constEnd()) {
+        return cached.value();
+    }
+
+    const QUrl url = windowUrlFromMetadata(appId, pid, rulesConfig, xWindowsWMClassName);
+
+    //! unresolved windows are not cached because their process information
+    //! may not be available yet
+    if (url.isEmpty()) {
+        return url;
+    }
+
+    //! applications are usually the same for the whole session, so a plain reset is enough
+    //! to keep the cache bounded
+    if (m_urls.count() >= MAXCACHEDAPPIDENTITIES) {
+        m_urls.clear();
+    }
+
+    m_urls[key] = url;
+    m_cacheChanged = true;
+    m_saveTimer.start();
+
+    return url;
+}
+
+AppData AppIdentityCache::appData(const QUrl &url)
+{
+    const QString key = url.toString();
+
+    auto cached = m_appData.constFind(key);
+
+    if (cached != m_appData.constEnd()) {
+        return cached.value();
+    }
+
+    const AppData data = appDataFromUrl(url);
+
+    if (!url.isEmpty()) {
+        if (m_appData.count() >= MAXCACHEDAPPIDENTITIES) {
+            m_appData.clear();
+        }
+
+        m_appData[key] = data;
+    }
+
+    return data;
+}
+
+void AppIdentityCache::loadCache()
+{
+    QFile cacheFile(m_cacheFile);
+
+    if (!cacheFile.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream in(&cacheFile);
+    in.setVersion(QDataStream::Qt_5_9);
+
+    quint32 magic{0};
+    quint32 version{0};
+    qint64 timestamp{0};
+    qint64 rulesTimestamp{0};
+    quint32 count{0};
+
+    in >> magic >> version >> timestamp >> rulesTimestamp >> count;
+
+    if (magic != APPIDENTITYCACHEMAGIC || version != APPIDENTITYCACHEVERSION) {
+        qDebug() << "Application identities cache is ignored because it is not compatible :: " << m_cacheFile;
+        return;
+    }
+
+    if (timestamp != sycocaTimestamp()) {
+        qDebug() << "Application identities cache is ignored because services database was updated :: " << m_cacheFile;
+        return;
+    }
+
+    if (rulesTimestamp != this->rulesTimestamp()) {
+        qDebug() << "Application identities cache is ignored because taskmanagerrulesrc was updated :: " << m_cacheFile;
+        return;
+    }
+
+    QHash<QString, QUrl> loaded;
+
+    for (quint32 i=0; i<count && in.status() == QDataStream::Ok; ++i) {
+        QString key;
+        QUrl url;
+
+        in >> key >> url;
+        loaded[key] = url;
+    }
+
+    if (in.status() != QDataStream::Ok) {
+        qDebug() << "Application identities cache is ignored because it is corrupted :: " << m_cacheFile;
+        return;
+    }
+
+    m_urls = loaded;
+
+    qDebug() << "Application identities cache loaded :: " << m_urls.count() << " applications";
+}
+
+void AppIdentityCache::saveCache()
+{
+    m_saveTimer.stop();
+
+    QDir().mkpath(QFileInfo(m_cacheFile).absolutePath());
+
+    QSaveFile cacheFile(m_cacheFile);
+
+    if (!cacheFile.open(QIODevice::WriteOnly)) {
+        qDebug() << "Application identities cache can not be written :: " << m_cacheFile;
+        return;
+    }
+
+    QDataStream out(&cacheFile);
+    out.setVersion(QDataStream::Qt_5_9);
+
+    out << (quint32)APPIDENTITYCACHEMAGIC << (quint32)APPIDENTITYCACHEVERSION << sycocaTimestamp() << rulesTimestamp() << (quint32)m_urls.count();
+
+    for (auto it = m_urls.constBegin(); it != m_urls.constEnd(); ++it) {
+        out << it.key() << it.value();
+    }
+
+    if (cacheFile.commit()) {
+        m_cacheChanged = false;
+    }
+}
+
+}
+}
@@ -0,0 +1,91 @@
+/*
+*  Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef APPIDENTITYCACHE_H
+#define APPIDENTITYCACHE_H
+
+// local
+#include "tasktools.h"
+
+// Qt
+#include <QHash>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <QUrl>
+
+// KDE
+#include <KSharedConfig>
+
+namespace Latte {
+namespace WindowSystem {
+
+//! Resolving the application of a window requires reading the process information,
+//! evaluating taskmanagerrulesrc and many service database queries. Windows of the same
+//! application always resolve to the same url, so the resolved urls are cached
+//! based on (appId, WM_CLASS name, process identity) and are stored in a file
+//! in order to be reused after restarts. The cache is dropped whenever the
+//! service database (ksycoca) or taskmanagerrulesrc are changed.
+class AppIdentityCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    AppIdentityCache(QObject *parent = nullptr);
+    ~AppIdentityCache() override;
+
+    QUrl windowUrl(const QString &appId, quint32 pid, KSharedConfig::Ptr rulesConfig, const QString &xWindowsWMClassName = QString());
+    AppData appData(const QUrl &url);
+
+private slots:
+    void clear();
+    void onRulesFileChanged(const QString &path);
+
+private:
+    void loadCache();
+    void saveCache();
+
+    qint64 sycocaTimestamp() const;
+    qint64 rulesTimestamp() const;
+    QString processExecutable(quint32 pid) const;
+    //! the executable or the full command line for processes of ignored runtimes
+    QString processIdentity(quint32 pid, KSharedConfig::Ptr rulesConfig) const;
+
+private:
+    bool m_cacheChanged{false};
+    //! the shared rules config must be reparsed before it is used again
+    bool m_rulesChanged{false};
+
+    //! persistent file for resolved urls, it is loaded at startup
+    QString m_cacheFile;
+    QString m_rulesFile;
+    //! avoid writing the cache file for each new application
+    QTimer m_saveTimer;
+
+    //! appId/WM_CLASS name/process identity, resolved window url
+    QHash<QString, QUrl> m_urls;
+    //! resolved window url, application data. Icons can not be stored
+    //! so this one is kept only in memory
+    QHash<QString, AppData> m_appData;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,175 @@
+/*
+*  Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "windowsindex.h"
+
+#define CELLSIZE 256
+//! windows with bogus huge geometries are not split in cells, they are always candidates
+#define MAXCELLSPERWINDOW 1024
+
+namespace Latte {
+namespace WindowSystem {
+namespace Tracker {
+
+WindowsIndex::WindowsIndex()
+{
+}
+
+int WindowsIndex::cell(int coordinate)
+{
+    //! floor division, windows can be placed at negative coordinates
+    return coordinate >= 0 ? coordinate / CELLSIZE : -((-coordinate - 1) / CELLSIZE) - 1;
+}
+
+qint64 WindowsIndex::cellKey(int column, int row)
+{
+    return ((qint64)column << 32) | (quint32)row;
+}
+
+bool WindowsIndex::hasFaultyWindows() const
+{
+    return m_faultyWindows > 0;
+}
+
+void WindowsIndex::clear()
+{
+    m_faultyWindows = 0;
+    m_cells.clear();
+    m_windows.clear();
+    m_stateWindows.clear();
+}
+
+void WindowsIndex::insertInCells(const WindowId &wid, const QRect &geometry)
+{
+    for (int column = cell(geometry.left()); column <= cell(geometry.right()); ++column) {
+        for (int row = cell(geometry.top()); row <= cell(geometry.bottom()); ++row) {
+            m_cells[cellKey(column, row)].append(wid);
+        }
+    }
+}
+
+void WindowsIndex::removeFromCells(const WindowId &wid, const QRect &geometry)
+{
+    for (int column = cell(geometry.left()); column <= cell(geometry.right()); ++column) {
+        for (int row = cell(geometry.top()); row <= cell(geometry.bottom()); ++row) {
+            qint64 key = cellKey(column, row);
+
+            if (!m_cells.contains(key)) {
+                continue;
+            }
+
+            m_cells[key].removeOne(wid);
+
+            if (m_cells[key].isEmpty()) {
+                m_cells.remove(key);
+            }
+        }
+    }
+}
+
+void WindowsIndex::remove(const WindowId &wid)
+{
+    if (!m_windows.contains(wid)) {
+        return;
+    }
+
+    const IndexedWindow indexed = m_windows.take(wid);
+
+    if (indexed.isFaulty) {
+        m_faultyWindows--;
+    }
+
+    if (indexed.isState || indexed.isOversized) {
+        m_stateWindows.remove(wid);
+    }
+
+    if (!indexed.isOversized && indexed.geometry.isValid()) {
+        removeFromCells(wid, indexed.geometry);
+    }
+}
+
+void WindowsIndex::update(const WindowId &wid, const WindowInfoWrap &winfo)
+{
+    IndexedWindow indexed;
+    indexed.geometry = winfo.geometry();
+    indexed.isState = winfo.isActive() || winfo.isMaximized();
+    indexed.isFaulty = (winfo.wid()<=0 || winfo.geometry() == QRect(0, 0, 0, 0));
+
+    if (indexed.geometry.isValid()) {
+        qint64 columns = cell(indexed.geometry.right()) - cell(indexed.geometry.left()) + 1;
+        qint64 rows = cell(indexed.geometry.bottom()) - cell(indexed.geometry.top()) + 1;
+        indexed.isOversized = (columns * rows > MAXCELLSPERWINDOW);
+    }
+
+    if (m_windows.contains(wid)) {
+        const IndexedWindow &previous = m_windows[wid];
+
+        if (previous.geometry == indexed.geometry
+                && previous.isState == indexed.isState
+                && previous.isFaulty == indexed.isFaulty) {
+            return;
+        }
+
+        remove(wid);
+    }
+
+    m_windows[wid] = indexed;
+
+    if (indexed.isFaulty) {
+        m_faultyWindows++;
+    }
+
+    if (indexed.isState || indexed.isOversized) {
+        m_stateWindows[wid] = true;
+    }
+
+    if (!indexed.isOversized && indexed.geometry.isValid()) {
+        insertInCells(wid, indexed.geometry);
+    }
+}
+
+QList<WindowId> WindowsIndex::candidates(const QRect &area) const
+{
+    //! QMap is used in order to provide the windows in the same order as the tracker windows
+    QMap<WindowId, bool> found = m_stateWindows;
+
+    if (area.isValid()) {
+        for (int column = cell(area.left()); column <= cell(area.right()); ++column) {
+            for (int row = cell(area.top()); row <= cell(area.bottom()); ++row) {
+                qint64 key = cellKey(column, row);
+
+                if (!m_cells.contains(key)) {
+                    continue;
+                }
+
+                for (const auto &wid : m_cells[key]) {
+                    if (!found.contains(wid) && m_windows[wid].geometry.intersects(area)) {
+                        found[wid] = true;
+                    }
+                }
+            }
+        }
+    }
+
+    return found.keys();
+}
+
+}
+}
+}
@@ -0,0 +1,84 @@
+/*
+*  Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+*
+*  This file is part of Latte-Dock
+*
+*  Latte-Dock is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU General Public License as
+*  published by the Free Software Foundation; either version 2 of
+*  the License, or (at your option) any later version.
+*
+*  Latte-Dock is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WINDOWSYSTEMTRACKERWINDOWSINDEX_H
+#define WINDOWSYSTEMTRACKERWINDOWSINDEX_H
+
+// local
+#include "../windowinfowrap.h"
+
+// Qt
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QRect>
+
+namespace Latte {
+namespace WindowSystem {
+namespace Tracker {
+
+//! Spatial index of the tracked windows. Window geometries are stored in a grid of
+//! fixed size cells and are updated incrementally, so views can test only the windows
+//! that are found near them. Active and maximized windows are always provided because
+//! they are affecting views hints even when they are not close to them.
+class WindowsIndex
+{
+public:
+    WindowsIndex();
+
+    bool hasFaultyWindows() const;
+
+    void clear();
+    void remove(const WindowId &wid);
+    void update(const WindowId &wid, const WindowInfoWrap &winfo);
+
+    //! windows that intersect area and all active and maximized windows, in WindowId order
+    QList<WindowId> candidates(const QRect &area) const;
+
+private:
+    struct IndexedWindow {
+        QRect geometry;
+        bool isState{false};
+        bool isFaulty{false};
+        bool isOversized{false};
+    };
+
+    static int cell(int coordinate);
+    static qint64 cellKey(int column, int row);
+
+    void insertInCells(const WindowId &wid, const QRect &geometry);
+    void removeFromCells(const WindowId &wid, const QRect &geometry);
+
+private:
+    int m_faultyWindows{0};
+
+    //! cell key, windows that intersect this cell
+    QHash<qint64, QList<WindowId>> m_cells;
+
+    QMap<WindowId, IndexedWindow> m_windows;
+
+    //! active, maximized and oversized windows that are always candidates
+    QMap<WindowId, bool> m_stateWindows;
+};
+
+}
+}
+}
+
+#endif
@@ -79,29 +79,47 @@ void Windows::init()
     connect(m_wm->corona(), &Plasma::Corona::availableScreenRectChanged, this, &Windows::updateAvailableScreenGeometries);
 
     connect(m_wm, &AbstractWindowInterface::windowChanged, this, [&](WindowId wid) {
-        m_windows[wid] = m_wm->requestInfo(wid);
-        updateAllHints();
+        WindowInfoWrap oldInfo = m_windows.value(wid);
+        setWindowInfo(wid, m_wm->requestInfo(wid));
+        updateHintsForWindowsChange({oldInfo}, {m_windows[wid]});
 
         emit windowChanged(wid);
     });
 
+    connect(m_wm, &AbstractWindowInterface::windowsChanged, this, [&](const QList<WindowId> &wids) {
+        const QList<WindowInfoWrap> infos = m_wm->requestInfos(wids);
+        QList<WindowInfoWrap> oldInfos;
+
+        for (int i=0; i<wids.count(); ++i) {
+            oldInfos << m_windows.value(wids[i]);
+            setWindowInfo(wids[i], infos[i]);
+        }
+
+        updateHintsForWindowsChange(oldInfos, infos);
+
+        for (const auto &wid : wids) {
+            emit windowChanged(wid);
+        }
+    });
+
     connect(m_wm, &AbstractWindowInterface::windowRemoved, this, [&](WindowId wid) {
-        m_windows.remove(wid);
+        WindowInfoWrap oldInfo = m_windows.take(wid);
+        m_windowsIndex.remove(wid);
 
         //! application data
-        m_initializedApplicationData.removeAll(wid);
-        m_delayedApplicationData.removeAll(wid);
+        m_initializedApplicationData.remove(wid);
+        m_delayedApplicationData.remove(wid);
 
-        updateAllHints();
+        updateHintsForWindowsChange({oldInfo}, {WindowInfoWrap()});
 
         emit windowRemoved(wid);
     });
 
     connect(m_wm, &AbstractWindowInterface::windowAdded, this, [&](WindowId wid) {
         if (!m_windows.contains(wid)) {
-            m_windows.insert(wid, m_wm->requestInfo(wid));
+            setWindowInfo(wid, m_wm->requestInfo(wid));
+            updateHintsForWindowsChange({WindowInfoWrap()}, {m_windows[wid]});
         }
-        updateAllHints();
     });
 
     connect(m_wm, &AbstractWindowInterface::activeWindowChanged, this, [&](WindowId wid) {
@@ -110,11 +128,11 @@ void Windows::init()
         for (const auto view : m_views.keys()) {
             WindowId lastWinId = m_views[view]->lastActiveWindow()->winId();
             if ((lastWinId) != wid && m_windows.contains(lastWinId)) {
-                m_windows[lastWinId] = m_wm->requestInfo(lastWinId);
+                setWindowInfo(lastWinId, m_wm->requestInfo(lastWinId));
             }
         }
 
-        m_windows[wid] = m_wm->requestInfo(wid);
+        setWindowInfo(wid, m_wm->requestInfo(wid));
         updateAllHints();
 
         emit activeWindowChanged(wid);
@@ -188,6 +206,16 @@ void Windows::addView(Latte::View *view)
         addRelevantLayout(view);
     });
 
+    //! windows changes update only the views that are close to them, so the view
+    //! must update its own hints when it is moved or resized
+    connect(view, &Latte::View::absoluteGeometryChanged, this, [&, view]() {
+        updateHints(view);
+    });
+
+    connect(view, &Latte::View::locationChanged, this, [&, view]() {
+        updateHints(view);
+    });
+
     connect(view, &Latte::View::isTouchingBottomViewAndIsBusyChanged, this, &Windows::updateExtraViewHints);
     connect(view, &Latte::View::isTouchingTopViewAndIsBusyChanged, this, &Windows::updateExtraViewHints);
 
@@ -196,6 +224,19 @@ void Windows::addView(Latte::View *view)
     emit informationAnnounced(view);
 }
 
+void Windows::addWindows(const QList<WindowId> &wids)
+{
+    const QList<WindowInfoWrap> infos = m_wm->requestInfos(wids);
+
+    for (int i=0; i<wids.count(); ++i) {
+        if (!m_windows.contains(wids[i]) && infos[i].isValid()) {
+            setWindowInfo(wids[i], infos[i]);
+        }
+    }
+
+    updateAllHints();
+}
+
 void Windows::removeView(Latte::View *view)
 {
     if (!m_views.contains(view)) {
@@ -641,7 +682,7 @@ QString Windows::appNameFor(const WindowId &wid)
     }
 
     if(!m_initializedApplicationData.contains(wid) && !m_delayedApplicationData.contains(wid)) {
-        m_delayedApplicationData.append(wid);
+        m_delayedApplicationData[wid] = true;
         m_updateApplicationDataTimer.start();
     }
 
@@ -659,9 +700,9 @@ QString Windows::appNameFor(const WindowId &wid)
 void Windows::updateApplicationData()
 {
     if (m_delayedApplicationData.count() > 0) {
-        for(int i=0; i<m_delayedApplicationData.count(); ++i) {
-            auto wid = m_delayedApplicationData[i];
+        const QList<WindowId> delayed = m_delayedApplicationData.keys();
 
+        for(const auto &wid : delayed) {
             if (m_windows.contains(wid)) {
                 AppData data = m_wm->appDataFor(wid);
 
@@ -674,7 +715,7 @@ void Windows::updateApplicationData()
                 m_windows[wid].setIcon(icon);
                 m_windows[wid].setAppName(data.name);
 
-                m_initializedApplicationData.append(wid);
+                m_initializedApplicationData[wid] = true;
 
                 emit applicationDataChanged(wid);
             }
@@ -701,6 +742,56 @@ bool Windows::intersects(Latte::View *view, const WindowInfoWrap &winfo)
     return (!winfo.isMinimized() && !winfo.isShaded() && winfo.geometry().intersects(view->absoluteGeometry()));
 }
 
+bool Windows::isTracked(const WindowInfoWrap &winfo)
+{
+    return (winfo.isValid()
+            && !winfo.isMinimized()
+            && m_wm->inCurrentDesktopActivity(winfo)
+            && !m_wm->hasBlockedTracking(winfo.wid()));
+}
+
+bool Windows::isNearView(Latte::View *view, const WindowInfoWrap &winfo)
+{
+    //! view area is expanded by one pixel in order to include also windows that are touching its edges
+    return (winfo.isValid() && winfo.geometry().intersects(view->absoluteGeometry().adjusted(-1, -1, 1, 1)));
+}
+
+bool Windows::isAffectingHintsChange(Latte::View *view, const WindowInfoWrap &oldInfo, const WindowInfoWrap &newInfo)
+{
+    if (isNearView(view, oldInfo) || isNearView(view, newInfo)) {
+        return true;
+    }
+
+    //! windows that are not close to the view can only change its active and maximized hints
+    bool oldTracked = isTracked(oldInfo);
+    bool newTracked = isTracked(newInfo);
+
+    bool oldActive = oldTracked && isActiveInViewScreen(view, oldInfo);
+    bool newActive = newTracked && isActiveInViewScreen(view, newInfo);
+    bool oldMaximized = oldTracked && isMaximizedInViewScreen(view, oldInfo);
+    bool newMaximized = newTracked && isMaximizedInViewScreen(view, newInfo);
+
+    return (oldActive != newActive
+            || oldMaximized != newMaximized
+            || (newMaximized && oldInfo.isActive() != newInfo.isActive())
+            || (newActive && oldInfo.parentId() != newInfo.parentId()));
+}
+
+bool Windows::isAffectingHintsChange(Latte::Layout::GenericLayout *layout, const WindowInfoWrap &oldInfo, const WindowInfoWrap &newInfo)
+{
+    Q_UNUSED(layout)
+
+    bool oldTracked = isTracked(oldInfo);
+    bool newTracked = isTracked(newInfo);
+
+    bool oldMaximized = oldTracked && oldInfo.isMaximized();
+    bool newMaximized = newTracked && newInfo.isMaximized();
+
+    return ((oldTracked && isActive(oldInfo)) != (newTracked && isActive(newInfo))
+            || oldMaximized != newMaximized
+            || (newMaximized && oldInfo.isActive() != newInfo.isActive()));
+}
+
 bool Windows::isActive(const WindowInfoWrap &winfo)
 {
     return (winfo.isValid() && winfo.isActive() && !winfo.isMinimized());
@@ -793,10 +884,17 @@ void Windows::cleanupFaultyWindows()
         if (winfo.wid()<=0 || winfo.geometry() == QRect(0, 0, 0, 0)) {
             //qDebug() << "Faulty Geometry ::: " << winfo.wid();
             m_windows.remove(key);
+            m_windowsIndex.remove(key);
         }
     }
 }
 
+void Windows::setWindowInfo(const WindowId &wid, const WindowInfoWrap &winfo)
+{
+    m_windows[wid] = winfo;
+    m_windowsIndex.update(wid, winfo);
+}
+
 
 void Windows::updateAvailableScreenGeometries()
 {
@@ -830,6 +928,34 @@ void Windows::updateAllHints()
     }
 }
 
+//! Windows changes are updating only the views and layouts whose hints can be affected
+//! by comparing the windows old and new information. Screen geometries changes are still
+//! updating the views fully through updateAvailableScreenGeometries()
+void Windows::updateHintsForWindowsChange(const QList<WindowInfoWrap> &oldInfos, const QList<WindowInfoWrap> &newInfos)
+{
+    for (const auto view : m_views.keys()) {
+        for (int i=0; i<oldInfos.count(); ++i) {
+            if (isAffectingHintsChange(view, oldInfos[i], newInfos[i])) {
+                updateHints(view);
+                break;
+            }
+        }
+    }
+
+    for (const auto layout : m_layouts.keys()) {
+        for (int i=0; i<oldInfos.count(); ++i) {
+            if (isAffectingHintsChange(layout, oldInfos[i], newInfos[i])) {
+                updateHints(layout);
+                break;
+            }
+        }
+    }
+
+    if (!m_extraViewHintsTimer.isActive()) {
+        m_extraViewHintsTimer.start();
+    }
+}
+
 void Windows::updateExtraViewHints()
 {
     for (const auto horView : m_views.keys()) {
@@ -896,12 +1022,20 @@ void Windows::updateHints(Latte::View *view)
 
     //qDebug() << " -- TRACKING REPORT (SCREEN)--";
 
+    existsFaultyWindow = m_windowsIndex.hasFaultyWindows();
+
+    //! only windows that are touching the view edges or they are active and maximized can affect the view hints,
+    //! the view area is expanded by one pixel in order to include also windows that are touching its edges
+    const QList<WindowId> candidates = m_windowsIndex.candidates(view->absoluteGeometry().adjusted(-1, -1, 1, 1));
+
     //! First Pass
-    for (const auto &winfo : m_windows) {
-        if (!existsFaultyWindow && (winfo.wid()<=0 || winfo.geometry() == QRect(0, 0, 0, 0))) {
-            existsFaultyWindow = true;
+    for (const auto &wid : candidates) {
+        if (!m_windows.contains(wid)) {
+            continue;
         }
 
+        const WindowInfoWrap &winfo = m_windows[wid];
+
         if ( !m_wm->inCurrentDesktopActivity(winfo)
              || m_wm->hasBlockedTracking(winfo.wid())
              || winfo.isMinimized()) {
@@ -973,7 +1107,13 @@ void Windows::updateHints(Latte::View *view)
         WindowInfoWrap activeInfo = m_windows[activeWinId];
         WindowId mainWindowId = activeInfo.isChildWindow() ? activeInfo.parentId() : activeWinId;
 
-        for (const auto &winfo : m_windows) {
+        for (const auto &wid : candidates) {
+            if (!m_windows.contains(wid)) {
+                continue;
+            }
+
+            const WindowInfoWrap &winfo = m_windows[wid];
+
             if (!m_wm->inCurrentDesktopActivity(winfo)
                     || m_wm->hasBlockedTracking(winfo.wid())
                     || winfo.isMinimized()) {
@@ -1063,11 +1203,18 @@ void Windows::updateHints(Latte::Layout::GenericLayout *layout) {
     WindowId activeWinId;
     WindowId maxWinId;
 
-    for (const auto &winfo : m_windows) {
-        if (!existsFaultyWindow && (winfo.wid()<=0 || winfo.geometry() == QRect(0, 0, 0, 0))) {
-            existsFaultyWindow = true;
+    existsFaultyWindow = m_windowsIndex.hasFaultyWindows();
+
+    //! only active and maximized windows can affect the layout hints
+    const QList<WindowId> candidates = m_windowsIndex.candidates(QRect());
+
+    for (const auto &wid : candidates) {
+        if (!m_windows.contains(wid)) {
+            continue;
         }
 
+        const WindowInfoWrap &winfo = m_windows[wid];
+
         if (!m_wm->inCurrentDesktopActivity(winfo)
                 || m_wm->hasBlockedTracking(winfo.wid())
                 || winfo.isMinimized()) {
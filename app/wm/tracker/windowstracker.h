@@ -22,6 +22,7 @@
 
 // local
 #include <coretypes.h>
+#include "windowsindex.h"
 #include "../windowinfowrap.h"
 
 // Qt
@@ -62,6 +63,9 @@ public:
     void addView(Latte::View *view);
     void removeView(Latte::View *view);
 
+    //! windows are requested from the window manager in a single batch
+    void addWindows(const QList<WindowId> &wids);
+
     //! Views Tracking (current screen specific)
     bool enabled(Latte::View *view);
     void setEnabled(Latte::View *view, const bool enabled);
@@ -139,8 +143,10 @@ private:
     void initLayoutHints(Latte::Layout::GenericLayout *layout);
     void initViewHints(Latte::View *view);
     void cleanupFaultyWindows();
+    void setWindowInfo(const WindowId &wid, const WindowInfoWrap &winfo);
 
     void updateAllHints();
+    void updateHintsForWindowsChange(const QList<WindowInfoWrap> &oldInfos, const QList<WindowInfoWrap> &newInfos);
 
     //! Views
     void updateHints(Latte::View *view);
@@ -166,6 +172,10 @@ private:
     //! Windows
     bool intersects(Latte::View *view, const WindowInfoWrap &winfo);
     bool isActive(const WindowInfoWrap &winfo);
+    bool isAffectingHintsChange(Latte::View *view, const WindowInfoWrap &oldInfo, const WindowInfoWrap &newInfo);
+    bool isAffectingHintsChange(Latte::Layout::GenericLayout *layout, const WindowInfoWrap &oldInfo, const WindowInfoWrap &newInfo);
+    bool isNearView(Latte::View *view, const WindowInfoWrap &winfo);
+    bool isTracked(const WindowInfoWrap &winfo);
     bool isActiveInViewScreen(Latte::View *view, const WindowInfoWrap &winfo);
     bool isMaximizedInViewScreen(Latte::View *view, const WindowInfoWrap &winfo);
     bool isTouchingView(Latte::View *view, const WindowSystem::WindowInfoWrap &winfo);
@@ -196,12 +206,15 @@ private:
 
     QMap<WindowId, WindowInfoWrap> m_windows;
 
+    //! spatial index of m_windows in order to check only the windows that can affect each view
+    WindowsIndex m_windowsIndex;
+
     //! Some applications delay their application name/icon identification
     //! such as Libreoffice that updates its StartupWMClass after
-    //! its startup
+    //! its startup. Both maps are cleaned up when their windows are removed
     QTimer m_updateApplicationDataTimer;
-    QList<WindowId> m_delayedApplicationData;
-    QList<WindowId> m_initializedApplicationData;
+    QMap<WindowId, bool> m_delayedApplicationData;
+    QMap<WindowId, bool> m_initializedApplicationData;
 };
 
 }
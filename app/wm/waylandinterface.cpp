@@ -542,8 +542,8 @@ AppData WaylandInterface::appDataFor(WindowId wid)
     auto window = windowFor(wid);
 
     if (window) {
-        const AppData &data = appDataFromUrl(windowUrlFromMetadata(window->appId(),
-                                                                   window->pid(), rulesConfig));
+        const AppData &data = m_appIdentityCache->appData(m_appIdentityCache->windowUrl(window->appId(),
+                                                                                        window->pid(), rulesConfig));
 
         return data;
     }
@@ -22,12 +22,14 @@
 
 // local
 #include <coretypes.h>
+#include "../debug.h"
 #include "tasktools.h"
 #include "view/view.h"
 #include "view/helpers/screenedgeghostwindow.h"
 
 // Qt
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QTimer>
 #include <QtX11Extras/QX11Info>
 
@@ -66,9 +68,20 @@ XWindowInterface::XWindowInterface(QObject *parent)
             , this, &XWindowInterface::windowChangedProxy);
 
 
+    //! windows that already exist are added together, each one of them still costs
+    //! a KWindowInfo round trip and only _GTK_FRAME_EXTENTS is requested for all of them at once
+    QList<WindowId> existingWindows;
+
     for(auto wid : KWindowSystem::self()->windows()) {
-        windowAddedProxy(wid);
+        existingWindows << wid;
     }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    windowsTracker()->addWindows(existingWindows);
+
+    qCDebug(LATTE_PERFORMANCE) << "Existing windows:" << existingWindows.count() << "were tracked in" << timer.elapsed() << "ms";
 }
 
 XWindowInterface::~XWindowInterface()
@@ -329,21 +342,59 @@ void XWindowInterface::setActiveEdge(QWindow *view, bool active)
 }
 
 #if KF5_VERSION_MINOR >= 65
-QRect XWindowInterface::visibleGeometry(const WindowId &wid, const QRect &frameGeometry) const
+xcb_atom_t XWindowInterface::gtkFrameExtentsAtom()
 {
-    NETWinInfo ni(QX11Info::connection(), wid.toUInt(), QX11Info::appRootWindow(), 0, NET::WM2GTKFrameExtents);
-    NETStrut struts = ni.gtkFrameExtents();
-    QMargins margins(struts.left, struts.top, struts.right, struts.bottom);
-    QRect visibleGeometry = frameGeometry;
+    if (m_gtkFrameExtentsAtom != XCB_ATOM_NONE) {
+        return m_gtkFrameExtentsAtom;
+    }
+
+    xcb_connection_t *c = QX11Info::connection();
+    const QByteArray atomName = QByteArrayLiteral("_GTK_FRAME_EXTENTS");
+    xcb_intern_atom_cookie_t atomCookie = xcb_intern_atom_unchecked(c, false, atomName.length(), atomName.constData());
+    QScopedPointer<xcb_intern_atom_reply_t, QScopedPointerPodDeleter> atom(xcb_intern_atom_reply(c, atomCookie, nullptr));
 
-    if (!margins.isNull()) {
-        visibleGeometry -= margins;
+    if (atom) {
+        m_gtkFrameExtentsAtom = atom->atom;
     }
 
-    return visibleGeometry;
+    return m_gtkFrameExtentsAtom;
 }
-#endif
 
+//! the requests for all windows are sent together and the replies are collected afterwards
+//! through gtkFrameExtentsReply(), this way they cost a single round trip to the X server
+QVector<xcb_get_property_cookie_t> XWindowInterface::requestGtkFrameExtents(const QList<WindowId> &wids)
+{
+    QVector<xcb_get_property_cookie_t> cookies;
+    xcb_atom_t atom = gtkFrameExtentsAtom();
+
+    if (atom == XCB_ATOM_NONE) {
+        return cookies;
+    }
+
+    xcb_connection_t *c = QX11Info::connection();
+    cookies.reserve(wids.count());
+
+    for (const auto &wid : wids) {
+        cookies << xcb_get_property_unchecked(c, false, wid.value<WId>(), atom, XCB_ATOM_CARDINAL, 0, 4);
+    }
+
+    return cookies;
+}
+
+QMargins XWindowInterface::gtkFrameExtentsReply(xcb_get_property_cookie_t cookie) const
+{
+    QScopedPointer<xcb_get_property_reply_t, QScopedPointerPodDeleter> reply(xcb_get_property_reply(QX11Info::connection(), cookie, nullptr));
+
+    if (!reply || reply->type != XCB_ATOM_CARDINAL || reply->format != 32 || xcb_get_property_value_length(reply.data()) < 16) {
+        return QMargins();
+    }
+
+    //! _GTK_FRAME_EXTENTS order: left, right, top, bottom
+    const uint32_t *extents = static_cast<const uint32_t *>(xcb_get_property_value(reply.data()));
+
+    return QMargins(extents[0], extents[2], extents[1], extents[3]);
+}
+#endif
 
 void XWindowInterface::setFrameExtents(QWindow *view, const QMargins &margins)
 {
@@ -443,28 +494,62 @@ WindowInfoWrap XWindowInterface::requestInfoActive()
 
 WindowInfoWrap XWindowInterface::requestInfo(WindowId wid)
 {
-    const KWindowInfo winfo{wid.value<WId>(), NET::WMFrameExtents
-                | NET::WMWindowType
-                | NET::WMGeometry
-                | NET::WMDesktop
-                | NET::WMState
-                | NET::WMName
-                | NET::WMVisibleName,
-                NET::WM2WindowClass
-                | NET::WM2Activities
-                | NET::WM2AllowedActions
-                | NET::WM2TransientFor};
+    return requestInfos({wid}).first();
+}
+
+QList<WindowInfoWrap> XWindowInterface::requestInfos(const QList<WindowId> &wids)
+{
+    QList<WindowInfoWrap> infos;
 
+#if KF5_VERSION_MINOR >= 65
+    //! KWindowInfo waits for its own replies when it is created, so only the
+    //! _GTK_FRAME_EXTENTS requests can be sent for all windows ahead of it
+    const QVector<xcb_get_property_cookie_t> frameExtentsCookies = requestGtkFrameExtents(wids);
+#endif
+
+    for (int i=0; i<wids.count(); ++i) {
+        const KWindowInfo winfo{wids[i].value<WId>(), NET::WMFrameExtents
+                    | NET::WMWindowType
+                    | NET::WMGeometry
+                    | NET::WMDesktop
+                    | NET::WMState
+                    | NET::WMName
+                    | NET::WMVisibleName,
+                    NET::WM2WindowClass
+                    | NET::WM2Activities
+                    | NET::WM2AllowedActions
+                    | NET::WM2TransientFor};
+
+        QRect geometry = winfo.frameGeometry();
+
+#if KF5_VERSION_MINOR >= 65
+        if (!frameExtentsCookies.isEmpty()) {
+            QMargins margins = gtkFrameExtentsReply(frameExtentsCookies[i]);
+
+            if (!margins.isNull()) {
+                geometry -= margins;
+            }
+        }
+#endif
+
+        infos << infoFromWindowInfo(wids[i], winfo, geometry);
+    }
+
+    return infos;
+}
+
+WindowInfoWrap XWindowInterface::infoFromWindowInfo(WindowId wid, const KWindowInfo &winfo, const QRect &geometry)
+{
     WindowInfoWrap winfoWrap;
 
     const auto winClass = QString(winfo.windowClassName());
 
     //!used to track Plasma DesktopView windows because during startup can not be identified properly
-    bool plasmaBlockedWindow = (winClass == QLatin1String("plasmashell") && !isAcceptableWindow(wid));
+    bool plasmaBlockedWindow = (winClass == QLatin1String("plasmashell") && !isAcceptableWindow(wid, winfo));
 
     if (!winfo.valid() || plasmaBlockedWindow) {
         winfoWrap.setIsValid(false);
-    } else if (isValidWindow(wid)) {
+    } else if (isValidWindow(wid, winfo)) {
         winfoWrap.setIsValid(true);
         winfoWrap.setWid(wid);
         winfoWrap.setParentId(winfo.transientFor());
@@ -476,11 +561,7 @@ WindowInfoWrap XWindowInterface::requestInfo(WindowId wid)
         winfoWrap.setIsShaded(winfo.hasState(NET::Shaded));
         winfoWrap.setIsOnAllDesktops(winfo.onAllDesktops());
         winfoWrap.setIsOnAllActivities(winfo.activities().empty());
-#if KF5_VERSION_MINOR >= 65
-        winfoWrap.setGeometry(visibleGeometry(wid, winfo.frameGeometry()));
-#else
-        winfoWrap.setGeometry(winfo.frameGeometry());
-#endif
+        winfoWrap.setGeometry(geometry);
         winfoWrap.setIsKeepAbove(winfo.hasState(NET::KeepAbove));
         winfoWrap.setIsKeepBelow(winfo.hasState(NET::KeepBelow));
         winfoWrap.setHasSkipPager(winfo.hasState(NET::SkipPager));
@@ -514,7 +595,7 @@ WindowInfoWrap XWindowInterface::requestInfo(WindowId wid)
 
 AppData XWindowInterface::appDataFor(WindowId wid)
 {
-    return appDataFromUrl(windowUrl(wid));
+    return m_appIdentityCache->appData(windowUrl(wid));
 }
 
 QUrl XWindowInterface::windowUrl(WindowId wid)
@@ -547,9 +628,9 @@ QUrl XWindowInterface::windowUrl(WindowId wid)
         }
     }
 
-    return windowUrlFromMetadata(info.windowClassClass(),
-                                 NETWinInfo(QX11Info::connection(), wid.value<WId>(), QX11Info::appRootWindow(), NET::WMPid, NET::Properties2()).pid(),
-                                 rulesConfig, info.windowClassName());
+    return m_appIdentityCache->windowUrl(info.windowClassClass(),
+                                         NETWinInfo(QX11Info::connection(), wid.value<WId>(), QX11Info::appRootWindow(), NET::WMPid, NET::Properties2()).pid(),
+                                         rulesConfig, info.windowClassName());
 }
 
 bool XWindowInterface::windowCanBeDragged(WindowId wid)
@@ -754,10 +835,25 @@ bool XWindowInterface::isValidWindow(WindowId wid)
     return isAcceptableWindow(wid);
 }
 
+bool XWindowInterface::isValidWindow(WindowId wid, const KWindowInfo &info)
+{
+    if (windowsTracker()->isValidFor(wid)) {
+        return true;
+    }
+
+    return isAcceptableWindow(wid, info);
+}
+
 bool XWindowInterface::isAcceptableWindow(WindowId wid)
 {
     const KWindowInfo info(wid.toUInt(), NET::WMGeometry | NET::WMState, NET::WM2WindowClass);
 
+    return isAcceptableWindow(wid, info);
+}
+
+//! info must provide at least NET::WMGeometry, NET::WMState and NET::WM2WindowClass
+bool XWindowInterface::isAcceptableWindow(WindowId wid, const KWindowInfo &info)
+{
     const auto winClass = QString(info.windowClassName());
 
     //! ignored windows do not trackd
@@ -28,11 +28,15 @@
 
 // Qt
 #include <QObject>
+#include <QVector>
 
 // KDE
 #include <KWindowInfo>
 #include <KWindowEffects>
 
+// X11
+#include <xcb/xcb.h>
+
 
 namespace Latte {
 namespace WindowSystem {
@@ -54,6 +58,7 @@ public:
     WindowId activeWindow() override;
     WindowInfoWrap requestInfo(WindowId wid) override;
     WindowInfoWrap requestInfoActive() override;
+    QList<WindowInfoWrap> requestInfos(const QList<WindowId> &wids) override;
 
     void skipTaskBar(const QDialog &dialog) override;
     void slideWindow(QWindow &view, Slide location) override;
@@ -87,10 +92,16 @@ public:
 
 private:
     bool isAcceptableWindow(WindowId wid);
+    bool isAcceptableWindow(WindowId wid, const KWindowInfo &info);
     bool isValidWindow(WindowId wid);
+    bool isValidWindow(WindowId wid, const KWindowInfo &info);
+
+    WindowInfoWrap infoFromWindowInfo(WindowId wid, const KWindowInfo &winfo, const QRect &geometry);
 
 #if KF5_VERSION_MINOR >= 65
-    QRect visibleGeometry(const WindowId &wid, const QRect &frameGeometry) const;
+    xcb_atom_t gtkFrameExtentsAtom();
+    QVector<xcb_get_property_cookie_t> requestGtkFrameExtents(const QList<WindowId> &wids);
+    QMargins gtkFrameExtentsReply(xcb_get_property_cookie_t cookie) const;
 #endif
 
     void windowAddedProxy(WId wid);
@@ -104,6 +115,8 @@ private:
     //xcb_shape
     bool m_shapeExtensionChecked{false};
     bool m_shapeAvailable{false};
+
+    xcb_atom_t m_gtkFrameExtentsAtom{XCB_ATOM_NONE};
 };
 
 }
@@ -33,6 +33,13 @@ Item {
 
     property real center: (root.isHorizontal ? appletItem.width : appletItem.height) / 2
 
+    //! applets that provide their own parabolic items must always be informed for zoom clearing
+    readonly property int parabolicIndex: appletItem.index
+    readonly property bool isParabolicContainer: communicator.parabolicEffectIsSupported
+
+    onParabolicIndexChanged: parabolic.engine.registerItem(_parabolicArea, parabolicIndex, isParabolicContainer)
+    onIsParabolicContainerChanged: parabolic.engine.registerItem(_parabolicArea, parabolicIndex, isParabolicContainer)
+
     MouseArea {
         id: parabolicMouseArea
         anchors.fill: parent
@@ -208,12 +215,10 @@ Item {
     }
 
     Component.onCompleted: {
-        parabolic.sglUpdateLowerItemScale.connect(sltUpdateLowerItemScale);
-        parabolic.sglUpdateHigherItemScale.connect(sltUpdateHigherItemScale);
+        parabolic.engine.registerItem(_parabolicArea, parabolicIndex, isParabolicContainer);
     }
 
     Component.onDestruction: {
-        parabolic.sglUpdateLowerItemScale.disconnect(sltUpdateLowerItemScale);
-        parabolic.sglUpdateHigherItemScale.disconnect(sltUpdateHigherItemScale);
+        parabolic.engine.unregisterItem(_parabolicArea);
     }
 }
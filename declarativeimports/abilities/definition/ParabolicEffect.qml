@@ -19,9 +19,12 @@
 
 import QtQuick 2.0
 
+import org.kde.latte.core 0.2 as LatteCore
+
 import "./paraboliceffect" as ParabolicEffectTypes
 
 Item {
+    id: _parabolicDefinition
     property bool isEnabled: false
     property bool restoreZoomIsBlocked: false
 
@@ -36,7 +39,22 @@ Item {
 
     property Item currentParabolicItem: null
 
+    //! delivers scale updates only to the items that are affected
+    readonly property QtObject engine: LatteCore.ParabolicEngine{}
+
     signal sglClearZoom();
     signal sglUpdateLowerItemScale(int delegateIndex, real newScale, real step);
     signal sglUpdateHigherItemScale(int delegateIndex, real newScale, real step);
+
+    Component.onCompleted: {
+        _parabolicDefinition.sglClearZoom.connect(engine.clearZoom);
+        _parabolicDefinition.sglUpdateLowerItemScale.connect(engine.updateLowerItemScale);
+        _parabolicDefinition.sglUpdateHigherItemScale.connect(engine.updateHigherItemScale);
+    }
+
+    Component.onDestruction: {
+        _parabolicDefinition.sglClearZoom.disconnect(engine.clearZoom);
+        _parabolicDefinition.sglUpdateLowerItemScale.disconnect(engine.updateLowerItemScale);
+        _parabolicDefinition.sglUpdateHigherItemScale.disconnect(engine.updateHigherItemScale);
+    }
 }
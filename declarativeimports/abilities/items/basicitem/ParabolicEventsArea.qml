@@ -36,6 +36,10 @@ Item {
     readonly property bool isThinTooltipEnabled: parabolicEventsAreaLoader.isThinTooltipEnabled
     readonly property real center: abilityItem.parabolicItem.center
 
+    readonly property int parabolicIndex: index
+
+    onParabolicIndexChanged: abilityItem.abilities.parabolic.engine.registerItem(_parabolicArea, parabolicIndex)
+
     MouseArea {
         id: parabolicMouseArea
         anchors.fill: parent
@@ -223,12 +227,10 @@ Item {
     }
 
     Component.onCompleted: {
-        abilityItem.abilities.parabolic.sglUpdateLowerItemScale.connect(sltUpdateLowerItemScale);
-        abilityItem.abilities.parabolic.sglUpdateHigherItemScale.connect(sltUpdateHigherItemScale);
+        abilityItem.abilities.parabolic.engine.registerItem(_parabolicArea, parabolicIndex);
     }
 
     Component.onDestruction: {
-        abilityItem.abilities.parabolic.sglUpdateLowerItemScale.disconnect(sltUpdateLowerItemScale);
-        abilityItem.abilities.parabolic.sglUpdateHigherItemScale.disconnect(sltUpdateHigherItemScale);
+        abilityItem.abilities.parabolic.engine.unregisterItem(_parabolicArea);
     }
 }
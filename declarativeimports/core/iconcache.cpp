@@ -0,0 +1,185 @@
+/*
+ * Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ * This file is part of Latte-Dock
+ *
+ * Latte-Dock is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * Latte-Dock is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "iconcache.h"
+
+// local
+#include "iconcolorscache.h"
+
+// Qt
+#include <QCache>
+#include <QCoreApplication>
+#include <QHash>
+#include <QLoggingCategory>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QQuickWindow>
+#include <QSet>
+#include <QSGTexture>
+#include <QWeakPointer>
+
+// Plasma
+#include <Plasma/Theme>
+
+//! pixmaps cost is measured in KB
+#define MAXPIXMAPSCOST 16384
+//! expired textures are removed when a window holds more than that
+#define MAXTEXTURESPERWINDOW 256
+
+namespace Latte {
+
+namespace {
+Q_LOGGING_CATEGORY(LATTE_PERFORMANCE, "org.kde.latte.performance", QtWarningMsg)
+
+QCache<QString, QPixmap> s_pixmaps(MAXPIXMAPSCOST);
+quint64 s_pixmapHits{0};
+quint64 s_pixmapMisses{0};
+
+QMutex s_texturesMutex;
+QHash<QQuickWindow *, QHash<qint64, QWeakPointer<QSGTexture>>> s_textures;
+//! windows whose destruction and scene graph invalidation are tracked
+QSet<QQuickWindow *> s_trackedWindows;
+quint64 s_textureHits{0};
+quint64 s_textureMisses{0};
+
+void forgetWindowTextures(QQuickWindow *window, bool destroyed)
+{
+    QMutexLocker locker(&s_texturesMutex);
+    s_textures.remove(window);
+
+    if (destroyed) {
+        s_trackedWindows.remove(window);
+    }
+}
+}
+
+bool IconCache::findPixmap(const QString &key, QPixmap &pixmap)
+{
+    const QPixmap *cached = key.isEmpty() ? nullptr : s_pixmaps.object(key);
+
+    if (!cached) {
+        s_pixmapMisses++;
+        return false;
+    }
+
+    s_pixmapHits++;
+    pixmap = *cached;
+    return true;
+}
+
+void IconCache::insertPixmap(const QString &key, const QPixmap &pixmap)
+{
+    if (key.isEmpty() || pixmap.isNull()) {
+        return;
+    }
+
+    const int cost = qMax(1, pixmap.width() * pixmap.height() * pixmap.depth() / (8 * 1024));
+    s_pixmaps.insert(key, new QPixmap(pixmap), cost);
+}
+
+void IconCache::clearPixmaps()
+{
+    s_pixmaps.clear();
+}
+
+void IconCache::trackThemeChanges()
+{
+    static Plasma::Theme *theme{nullptr};
+
+    if (theme || !qApp) {
+        return;
+    }
+
+    theme = new Plasma::Theme(qApp);
+
+    QObject::connect(theme, &Plasma::Theme::themeChanged, theme, []() {
+        qCDebug(LATTE_PERFORMANCE) << "Icon cache, theme changed," << statistics();
+        clearPixmaps();
+        IconColorsCache::self()->clear();
+    });
+
+    QObject::connect(qApp, &QCoreApplication::aboutToQuit, theme, []() {
+        qCDebug(LATTE_PERFORMANCE) << "Icon cache," << statistics();
+        //! cached pixmaps may be backed by the platform integration, they must not
+        //! outlive the application when the static cache is destroyed
+        clearPixmaps();
+    });
+}
+
+QSharedPointer<QSGTexture> IconCache::texture(QQuickWindow *window, const QPixmap &pixmap)
+{
+    if (!window || pixmap.isNull()) {
+        return QSharedPointer<QSGTexture>();
+    }
+
+    //! pixmaps that are shared through the pixmaps cache have the same cacheKey,
+    //! any change in their contents produces a new cacheKey
+    const qint64 key = pixmap.cacheKey();
+
+    QMutexLocker locker(&s_texturesMutex);
+
+    if (!s_trackedWindows.contains(window)) {
+        s_trackedWindows << window;
+
+        //! textures of a window are released with its scene graph
+        QObject::connect(window, &QObject::destroyed, [window]() {
+            forgetWindowTextures(window, true);
+        });
+
+        QObject::connect(window, &QQuickWindow::sceneGraphInvalidated, window, [window]() {
+            forgetWindowTextures(window, false);
+        }, Qt::DirectConnection);
+    }
+
+    QHash<qint64, QWeakPointer<QSGTexture>> &textures = s_textures[window];
+    QSharedPointer<QSGTexture> texture = textures.value(key).toStrongRef();
+
+    if (texture) {
+        s_textureHits++;
+        return texture;
+    }
+
+    s_textureMisses++;
+
+    if (textures.count() > MAXTEXTURESPERWINDOW) {
+        for (auto it = textures.begin(); it != textures.end();) {
+            if (it.value().isNull()) {
+                it = textures.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    texture = QSharedPointer<QSGTexture>(window->createTextureFromImage(pixmap.toImage(), QQuickWindow::TextureCanUseAtlas));
+    textures[key] = texture;
+
+    return texture;
+}
+
+QString IconCache::statistics()
+{
+    QMutexLocker locker(&s_texturesMutex);
+
+    return QString("pixmaps hits: %1 misses: %2, textures hits: %3 misses: %4")
+            .arg(s_pixmapHits).arg(s_pixmapMisses).arg(s_textureHits).arg(s_textureMisses);
+}
+
+}
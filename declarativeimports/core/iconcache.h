@@ -0,0 +1,58 @@
+/*
+ * Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ * This file is part of Latte-Dock
+ *
+ * Latte-Dock is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * Latte-Dock is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef LATTEICONCACHE_H
+#define LATTEICONCACHE_H
+
+// Qt
+#include <QPixmap>
+#include <QSharedPointer>
+#include <QString>
+
+class QQuickWindow;
+class QSGTexture;
+
+namespace Latte {
+
+//! Process wide cache that is shared between all IconItems. Rendered pixmaps are
+//! reused for items that show the same icon with the same size, state and overlays,
+//! and textures are reused per window for items that show the same pixmap
+class IconCache
+{
+public:
+    //! must be called only from the gui thread
+    static bool findPixmap(const QString &key, QPixmap &pixmap);
+    static void insertPixmap(const QString &key, const QPixmap &pixmap);
+    static void clearPixmaps();
+
+    //! cached pixmaps and colors are invalidated once for all items when plasma theme
+    //! or colors change, it is safe to be called many times
+    static void trackThemeChanges();
+
+    //! can be called from any scene graph render thread
+    static QSharedPointer<QSGTexture> texture(QQuickWindow *window, const QPixmap &pixmap);
+
+    //! logged under "org.kde.latte.performance" category on invalidation and on exit
+    static QString statistics();
+};
+
+}
+
+#endif
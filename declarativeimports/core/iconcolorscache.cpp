@@ -0,0 +1,237 @@
+/*
+ * Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ * This file is part of Latte-Dock
+ *
+ * Latte-Dock is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * Latte-Dock is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "iconcolorscache.h"
+
+// Qt
+#include <QMetaObject>
+#include <QRunnable>
+
+// C++
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define MAXCACHEDCOLORS 400
+
+namespace Latte {
+
+class IconColorsJob : public QRunnable
+{
+public:
+    IconColorsJob(IconColorsCache *cache, const QString &key, const QImage &icon)
+        : m_cache(cache),
+          m_key(key),
+          m_icon(icon)
+    {
+    }
+
+    void run() override
+    {
+        QColor background;
+        QColor glow;
+
+        IconColorsCache::calculateColors(m_icon, background, glow);
+
+        QMetaObject::invokeMethod(m_cache,
+                                  "onColorsCalculated",
+                                  Qt::QueuedConnection,
+                                  Q_ARG(QString, m_key),
+                                  Q_ARG(QColor, background),
+                                  Q_ARG(QColor, glow));
+    }
+
+private:
+    IconColorsCache *m_cache{nullptr};
+    QString m_key;
+    QImage m_icon;
+};
+
+IconColorsCache::IconColorsCache(QObject *parent)
+    : QObject(parent)
+{
+    m_calculationsPool.setMaxThreadCount(2);
+}
+
+IconColorsCache::~IconColorsCache()
+{
+    m_calculationsPool.clear();
+    m_calculationsPool.waitForDone();
+}
+
+IconColorsCache *IconColorsCache::self()
+{
+    static IconColorsCache cache;
+    return &cache;
+}
+
+bool IconColorsCache::colors(const QString &key, QColor &background, QColor &glow) const
+{
+    if (!m_colors.contains(key)) {
+        return false;
+    }
+
+    const iconColors &colors = m_colors[key];
+    background = colors.background;
+    glow = colors.glow;
+
+    return true;
+}
+
+void IconColorsCache::request(const QString &key, const QImage &icon)
+{
+    if (m_pendingKeys.contains(key)) {
+        return;
+    }
+
+    m_pendingKeys << key;
+    m_calculationsPool.start(new IconColorsJob(this, key, icon));
+}
+
+void IconColorsCache::clear()
+{
+    m_colors.clear();
+}
+
+void IconColorsCache::onColorsCalculated(const QString &key, const QColor &background, const QColor &glow)
+{
+    m_pendingKeys.remove(key);
+
+    if (background.isValid()) {
+        //! icons are usually tracked for the whole session, so a plain reset is enough
+        //! to keep the cache bounded when many different icons are shown over time
+        if (m_colors.count() >= MAXCACHEDCOLORS) {
+            m_colors.clear();
+        }
+
+        m_colors[key] = {background, glow};
+    }
+
+    emit colorsCalculated(key, background, glow);
+}
+
+void IconColorsCache::calculateColors(const QImage &icon, QColor &background, QColor &glow)
+{
+    if (icon.isNull()) {
+        return;
+    }
+
+    QImage image = icon;
+
+    if (image.format() != QImage::Format_ARGB32_Premultiplied
+            && image.format() != QImage::Format_ARGB32
+            && image.format() != QImage::Format_RGB32) {
+        image = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    }
+
+    //! every pixel contributes with a relevance of .1 + .9 * alpha * saturation
+    double rtotal{0}, gtotal{0}, btotal{0};
+    double total{0};
+
+#if defined(__SSE2__)
+    const __m128i channel = _mm_set1_epi32(0xff);
+    const __m128 minrelevance = _mm_set1_ps(0.1f);
+    const __m128 relevancefactor = _mm_set1_ps(0.9f / (255.0f * 255.0f));
+#endif
+
+    for (int row=0; row<image.height(); ++row) {
+        const QRgb *line = reinterpret_cast<const QRgb *>(image.constScanLine(row));
+        int col{0};
+
+#if defined(__SSE2__)
+        __m128 rsum = _mm_setzero_ps();
+        __m128 gsum = _mm_setzero_ps();
+        __m128 bsum = _mm_setzero_ps();
+        __m128 relsum = _mm_setzero_ps();
+
+        for (; col+4<=image.width(); col+=4) {
+            const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(line + col));
+
+            const __m128i b = _mm_and_si128(pixels, channel);
+            const __m128i g = _mm_and_si128(_mm_srli_epi32(pixels, 8), channel);
+            const __m128i r = _mm_and_si128(_mm_srli_epi32(pixels, 16), channel);
+            const __m128i a = _mm_srli_epi32(pixels, 24);
+
+            //! channels fit in the low 16 bits of each lane, so 16-bit min/max are exact
+            const __m128i maxchannel = _mm_max_epi16(r, _mm_max_epi16(g, b));
+            const __m128i minchannel = _mm_min_epi16(r, _mm_min_epi16(g, b));
+            const __m128 saturation = _mm_cvtepi32_ps(_mm_sub_epi32(maxchannel, minchannel));
+
+            const __m128 relevance = _mm_add_ps(minrelevance,
+                                                _mm_mul_ps(relevancefactor, _mm_mul_ps(_mm_cvtepi32_ps(a), saturation)));
+
+            rsum = _mm_add_ps(rsum, _mm_mul_ps(_mm_cvtepi32_ps(r), relevance));
+            gsum = _mm_add_ps(gsum, _mm_mul_ps(_mm_cvtepi32_ps(g), relevance));
+            bsum = _mm_add_ps(bsum, _mm_mul_ps(_mm_cvtepi32_ps(b), relevance));
+            relsum = _mm_add_ps(relsum, relevance);
+        }
+
+        float lanes[4];
+
+        _mm_storeu_ps(lanes, rsum);
+        rtotal += (double)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        _mm_storeu_ps(lanes, gsum);
+        gtotal += (double)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        _mm_storeu_ps(lanes, bsum);
+        btotal += (double)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        _mm_storeu_ps(lanes, relsum);
+        total += (double)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+
+        for (; col<image.width(); ++col) {
+            const QRgb pix = line[col];
+
+            const int r = qRed(pix);
+            const int g = qGreen(pix);
+            const int b = qBlue(pix);
+            const int a = qAlpha(pix);
+
+            const float saturation = (qMax(r, qMax(g, b)) - qMin(r, qMin(g, b))) / 255.0f;
+            const float relevance = .1f + .9f * (a / 255.0f) * saturation;
+
+            rtotal += r * relevance;
+            gtotal += g * relevance;
+            btotal += b * relevance;
+            total += relevance;
+        }
+    }
+
+    if (total <= 0) {
+        return;
+    }
+
+    QColor tempColor(qBound(0, (int)(rtotal / total), 255),
+                     qBound(0, (int)(gtotal / total), 255),
+                     qBound(0, (int)(btotal / total), 255));
+
+    if (tempColor.hsvSaturationF() > 0.15f) {
+        tempColor.setHsvF(tempColor.hueF(), 0.65f, tempColor.valueF());
+    }
+
+    tempColor.setHsvF(tempColor.hueF(), tempColor.saturationF(), 0.55f); //original 0.90f ???
+
+    background = tempColor;
+
+    tempColor.setHsvF(tempColor.hueF(), tempColor.saturationF(), 1.0f);
+
+    glow = tempColor;
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ * This file is part of Latte-Dock
+ *
+ * Latte-Dock is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * Latte-Dock is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef LATTEICONCOLORSCACHE_H
+#define LATTEICONCOLORSCACHE_H
+
+// Qt
+#include <QColor>
+#include <QHash>
+#include <QImage>
+#include <QObject>
+#include <QSet>
+#include <QThreadPool>
+
+namespace Latte {
+
+//! Calculates icons background and glow colors in a worker thread and shares
+//! the results between all IconItems that show the same icon at the same size
+class IconColorsCache final : public QObject
+{
+    Q_OBJECT
+
+public:
+    static IconColorsCache *self();
+    ~IconColorsCache() override;
+
+    //! returns true and fills the colors when they are already known for key
+    bool colors(const QString &key, QColor &background, QColor &glow) const;
+    //! colorsCalculated(key) is emitted when the colors become available
+    void request(const QString &key, const QImage &icon);
+    void clear();
+
+    static void calculateColors(const QImage &icon, QColor &background, QColor &glow);
+
+signals:
+    void colorsCalculated(const QString &key, const QColor &background, const QColor &glow);
+
+private slots:
+    void onColorsCalculated(const QString &key, const QColor &background, const QColor &glow);
+
+private:
+    IconColorsCache(QObject *parent = nullptr);
+
+private:
+    struct iconColors {
+        QColor background;
+        QColor glow;
+    };
+
+    QThreadPool m_calculationsPool;
+
+    QSet<QString> m_pendingKeys;
+    QHash<QString, iconColors> m_colors;
+};
+
+}
+
+#endif
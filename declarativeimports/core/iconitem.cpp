@@ -24,6 +24,8 @@
 
 // local
 #include "extras.h"
+#include "iconcache.h"
+#include "iconcolorscache.h"
 
 // Qt
 #include <QDebug>
@@ -64,6 +66,10 @@ IconItem::IconItem(QQuickItem *parent)
             this, SLOT(schedulePixmapUpdate()));
     connect(this, SIGNAL(providesColorsChanged()),
             this, SLOT(schedulePixmapUpdate()));
+    connect(IconColorsCache::self(), &IconColorsCache::colorsCalculated,
+            this, &IconItem::onColorsCalculated);
+
+    IconCache::trackThemeChanges();
 
     //initialize implicit size to the Dialog size
     setImplicitWidth(KIconLoader::global()->currentSize(KIconLoader::Dialog));
@@ -108,7 +114,7 @@ void IconItem::setSource(const QVariant &source)
                 m_svgIcon->setStatus(Plasma::Svg::Normal);
                 m_svgIcon->setUsingRenderingCache(false);
                 m_svgIcon->setDevicePixelRatio((window() ? window()->devicePixelRatio() : qApp->devicePixelRatio()));
-                connect(m_svgIcon.get(), &Plasma::Svg::repaintNeeded, this, &IconItem::schedulePixmapUpdate);
+                connect(m_svgIcon.get(), &Plasma::Svg::repaintNeeded, this, &IconItem::svgRepaintNeeded);
             }
 
             if (m_usesPlasmaTheme) {
@@ -369,7 +375,7 @@ QSGNode *IconItem::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *update
             delete oldNode;
 
         textureNode = new ManagedTextureNode;
-        textureNode->setTexture(QSharedPointer<QSGTexture>(window()->createTextureFromImage(m_iconPixmap.toImage(), QQuickWindow::TextureCanUseAtlas)));
+        textureNode->setTexture(IconCache::texture(window(), m_iconPixmap));
         textureNode->setFiltering(smooth() ? QSGTexture::Linear : QSGTexture::Nearest);
 
         m_sizeChanged = true;
@@ -396,6 +402,12 @@ void IconItem::enabledChanged()
     schedulePixmapUpdate();
 }
 
+void IconItem::svgRepaintNeeded()
+{
+    //! the shared caches are invalidated once through IconCache::trackThemeChanges()
+    schedulePixmapUpdate();
+}
+
 QColor IconItem::backgroundColor() const
 {
     return m_backgroundColor;
@@ -428,52 +440,75 @@ void IconItem::setGlowColor(QColor glow)
 
 void IconItem::updateColors()
 {
-    QImage icon = m_iconPixmap.toImage();
-
-    if (icon.format() != QImage::Format_Invalid) {
-        float rtotal = 0, gtotal = 0, btotal = 0;
-        float total = 0.0f;
+    if (m_iconPixmap.isNull()) {
+        return;
+    }
 
-        for(int row=0; row<icon.height(); ++row) {
-            QRgb *line = (QRgb *)icon.scanLine(row);
+    //! sources that are not named can not be shared between different items
+    const bool isShared = !m_lastLoadedSourceId.startsWith(QLatin1String("_icon_"))
+            && !m_lastLoadedSourceId.startsWith(QLatin1String("_image_"));
 
-            for(int col=0; col<icon.width(); ++col) {
-                QRgb pix = line[col];
+    m_colorsRequestKey = (isShared ? QString() : QString::number((quintptr)this, 16))
+            + m_lastLoadedSourceId
+            + "_" + QString::number(m_iconPixmap.width()) + "x" + QString::number(m_iconPixmap.height())
+            + "_" + renderingCacheKey();
 
-                int r = qRed(pix);
-                int g = qGreen(pix);
-                int b = qBlue(pix);
-                int a = qAlpha(pix);
+    QColor background;
+    QColor glow;
 
-                float saturation = (qMax(r, qMax(g, b)) - qMin(r, qMin(g, b))) / 255.0f;
-                float relevance = .1 + .9 * (a / 255.0f) * saturation;
+    if (IconColorsCache::self()->colors(m_colorsRequestKey, background, glow)) {
+        m_colorsRequestKey.clear();
+        setBackgroundColor(background);
+        setGlowColor(glow);
+        return;
+    }
 
-                rtotal += (float)(r * relevance);
-                gtotal += (float)(g * relevance);
-                btotal += (float)(b * relevance);
+    IconColorsCache::self()->request(m_colorsRequestKey, m_iconPixmap.toImage());
+}
 
-                total += relevance * 255;
-            }
-        }
+void IconItem::onColorsCalculated(const QString &key, const QColor &background, const QColor &glow)
+{
+    if (m_colorsRequestKey.isEmpty() || key != m_colorsRequestKey) {
+        return;
+    }
 
-        int nr = (rtotal / total) * 255;
-        int ng = (gtotal / total) * 255;
-        int nb = (btotal / total) * 255;
+    m_colorsRequestKey.clear();
 
-        QColor tempColor(nr, ng, nb);
+    if (background.isValid()) {
+        setBackgroundColor(background);
+        setGlowColor(glow);
+    }
+}
 
-        if (tempColor.hsvSaturationF() > 0.15f) {
-            tempColor.setHsvF(tempColor.hueF(), 0.65f, tempColor.valueF());
-        }
+QString IconItem::pixmapCacheKey(const qreal &size) const
+{
+    //! sources that are not named can not be shared between different items
+    if (m_lastLoadedSourceId.isEmpty()
+            || m_lastLoadedSourceId.startsWith(QLatin1String("_icon_"))
+            || m_lastLoadedSourceId.startsWith(QLatin1String("_image_"))) {
+        return QString();
+    }
 
-        tempColor.setHsvF(tempColor.hueF(), tempColor.saturationF(), 0.55f); //original 0.90f ???
+    const qreal dpr = (window() ? window()->devicePixelRatio() : qApp->devicePixelRatio());
 
-        setBackgroundColor(tempColor);
+    return m_lastLoadedSourceId
+            + "_" + QString::number(size)
+            + "_" + QString::number(dpr)
+            + "_" + renderingCacheKey();
+}
 
-        tempColor.setHsvF(tempColor.hueF(), tempColor.saturationF(), 1.0f);
+//! everything apart from the source and size that changes the rendered icon,
+//! it is shared between the pixmaps and the colors cache keys
+QString IconItem::renderingCacheKey() const
+{
+    const auto *iconTheme = KIconLoader::global()->theme();
+    const int state = !isEnabled() ? KIconLoader::DisabledState : (m_active ? KIconLoader::ActiveState : KIconLoader::DefaultState);
 
-        setGlowColor(tempColor);
-    }
+    return QString::number(state)
+            + "_" + QString::number(m_colorGroup)
+            + "_" + (m_usesPlasmaTheme ? "1" : "0")
+            + "_" + (iconTheme ? iconTheme->internalName() : QString())
+            + "_" + m_overlays.join(",");
 }
 
 void IconItem::loadPixmap()
@@ -486,11 +521,39 @@ void IconItem::loadPixmap()
     //final pixmap to paint
     QPixmap result;
 
-    if (size <= 0) {
+    if (size <= 0 || !isValid()) {
         m_iconPixmap = QPixmap();
         update();
         return;
-    } else if (m_svgIcon) {
+    }
+
+    const QString cacheKey = pixmapCacheKey(size);
+
+    if (!IconCache::findPixmap(cacheKey, result)) {
+        if (!renderPixmap(size, result)) {
+            m_iconPixmap = QPixmap();
+            update();
+            return;
+        }
+
+        IconCache::insertPixmap(cacheKey, result);
+    }
+
+    m_iconPixmap = result;
+
+    if (m_providesColors && m_lastLoadedSourceId != m_lastColorsSourceId) {
+        m_lastColorsSourceId = m_lastLoadedSourceId;
+        updateColors();
+    }
+
+    m_textureChanged = true;
+    //don't animate initial setting
+    update();
+}
+
+bool IconItem::renderPixmap(const qreal &size, QPixmap &result)
+{
+    if (m_svgIcon) {
         m_svgIcon->resize(size, size);
 
         if (m_svgIcon->hasElement(m_svgIconName)) {
@@ -525,9 +588,7 @@ void IconItem::loadPixmap()
     } else if (!m_imageIcon.isNull()) {
         result = QPixmap::fromImage(m_imageIcon);
     } else {
-        m_iconPixmap = QPixmap();
-        update();
-        return;
+        return false;
     }
 
     // Strangely KFileItem::overlays() returns empty string-values, so
@@ -550,16 +611,7 @@ void IconItem::loadPixmap()
         result = KIconLoader::global()->iconEffect()->apply(result, KIconLoader::Desktop, KIconLoader::ActiveState);
     }
 
-    m_iconPixmap = result;
-
-    if (m_providesColors && m_lastLoadedSourceId != m_lastColorsSourceId) {
-        m_lastColorsSourceId = m_lastLoadedSourceId;
-        updateColors();
-    }
-
-    m_textureChanged = true;
-    //don't animate initial setting
-    update();
+    return !result.isNull();
 }
 
 void IconItem::itemChange(ItemChange change, const ItemChangeData &value)
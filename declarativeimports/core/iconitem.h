@@ -171,10 +171,16 @@ signals:
 private slots:
     void schedulePixmapUpdate();
     void enabledChanged();
+    void svgRepaintNeeded();
+    void onColorsCalculated(const QString &key, const QColor &background, const QColor &glow);
 
 private:
     void loadPixmap();
+    bool renderPixmap(const qreal &size, QPixmap &result);
     void updateColors();
+
+    QString pixmapCacheKey(const qreal &size) const;
+    QString renderingCacheKey() const;
     void setLastLoadedSourceId(QString id);
     void setLastValidSourceName(QString name);
     void setBackgroundColor(QColor background);
@@ -214,6 +220,9 @@ private:
     //! last source name that was used in order to produce colors
     QString m_lastColorsSourceId;
 
+    //! colors key that is waiting for its calculation to finish
+    QString m_colorsRequestKey;
+
     QStringList m_overlays;
 
     Plasma::Theme::ColorGroup m_colorGroup;
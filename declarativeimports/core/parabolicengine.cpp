@@ -0,0 +1,210 @@
+/*
+ * Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ * This file is part of Latte-Dock
+ *
+ * Latte-Dock is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * Latte-Dock is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "parabolicengine.h"
+
+// Qt
+#include <QMetaObject>
+#include <QtMath>
+
+namespace Latte {
+
+ParabolicEngine::ParabolicEngine(QObject *parent)
+    : QObject(parent)
+{
+}
+
+ParabolicEngine::~ParabolicEngine()
+{
+}
+
+void ParabolicEngine::registerItem(QObject *item, int index, bool isContainer)
+{
+    if (!item) {
+        return;
+    }
+
+    if (m_indexes.contains(item)) {
+        unregisterItem(item);
+    } else {
+        connect(item, &QObject::destroyed, this, [&, item]() {
+            unregisterItem(item);
+        });
+    }
+
+    parabolicItem pitem;
+    pitem.item = item;
+    pitem.isContainer = isContainer;
+
+    m_items.insert(index, pitem);
+    m_indexes[item] = index;
+
+    //! new or moved items must be informed for the next zoom clearing
+    if (!m_zoomedIndexes.contains(index)) {
+        m_zoomedIndexes[index] = 1.0;
+    }
+}
+
+void ParabolicEngine::unregisterItem(QObject *item)
+{
+    if (!m_indexes.contains(item)) {
+        return;
+    }
+
+    const int index = m_indexes.take(item);
+
+    for (auto it = m_items.find(index); it != m_items.end() && it.key() == index; ++it) {
+        if (it.value().item == item || it.value().item.isNull()) {
+            m_items.erase(it);
+            break;
+        }
+    }
+
+    if (!m_items.contains(index)) {
+        m_zoomedIndexes.remove(index);
+    }
+}
+
+bool ParabolicEngine::hasContainer(const int &index) const
+{
+    for (auto it = m_items.constFind(index); it != m_items.constEnd() && it.key() == index; ++it) {
+        if (it.value().isContainer) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ParabolicEngine::setCleared(const int &index)
+{
+    //! containers can not know if any of their children is still zoomed
+    if (!hasContainer(index)) {
+        m_zoomedIndexes.remove(index);
+    }
+}
+
+QVariantMap ParabolicEngine::applyParabolicEffect(int index, qreal currentMousePosition, qreal center, qreal zoom, bool isReversed)
+{
+    const qreal rDistance = qAbs(currentMousePosition - center);
+
+    //check if the mouse goes right or down according to the center
+    bool positiveDirection = ((currentMousePosition - center) >= 0);
+
+    if (isReversed) {
+        positiveDirection = !positiveDirection;
+    }
+
+    //finding the zoom center e.g. for zoom:1.7, calculates 0.35
+    const qreal zoomCenter = (zoom - 1) / 2;
+
+    //computes the in the scale e.g. 0...0.35 according to the mouse distance
+    //0.35 on the edge and 0 in the center
+    const qreal firstComputation = center != 0 ? (rDistance / center) * zoomCenter : 0;
+
+    //calculates the scaling for the neighbour tasks
+    const qreal bigNeighbourZoom = qMin(1 + zoomCenter + firstComputation, zoom);
+    const qreal smallNeighbourZoom = qMax(1 + zoomCenter - firstComputation, 1.0);
+
+    //! the hovered item zooms itself
+    m_zoomedIndexes[index] = zoom;
+
+    QVariantMap scales;
+    scales["leftScale"] = positiveDirection ? smallNeighbourZoom : bigNeighbourZoom;
+    scales["rightScale"] = positiveDirection ? bigNeighbourZoom : smallNeighbourZoom;
+
+    return scales;
+}
+
+void ParabolicEngine::clearZoom()
+{
+    const QList<int> indexes = m_zoomedIndexes.keys();
+
+    for (const auto index : indexes) {
+        setCleared(index);
+    }
+}
+
+void ParabolicEngine::updateLowerItemScale(int delegateIndex, qreal newScale, qreal step)
+{
+    updateItemScale(Lower, delegateIndex, newScale, step);
+}
+
+void ParabolicEngine::updateHigherItemScale(int delegateIndex, qreal newScale, qreal step)
+{
+    updateItemScale(Higher, delegateIndex, newScale, step);
+}
+
+void ParabolicEngine::updateItemScale(const Direction &direction, int delegateIndex, qreal newScale, qreal step)
+{
+    const bool isClearing = (newScale == 1.0);
+
+    if (isClearing) {
+        setCleared(delegateIndex);
+    } else {
+        m_zoomedIndexes[delegateIndex] = newScale;
+    }
+
+    deliver(direction, delegateIndex, delegateIndex, newScale, step);
+
+    if (!isClearing) {
+        return;
+    }
+
+    //! clearing zoom is applied to all lower or higher items, but only the
+    //! ones that may be zoomed are informed
+    QList<int> affected;
+
+    if (direction == Lower) {
+        for (auto it = m_zoomedIndexes.constBegin(); it != m_zoomedIndexes.constEnd() && it.key() < delegateIndex; ++it) {
+            affected << it.key();
+        }
+    } else {
+        for (auto it = m_zoomedIndexes.upperBound(delegateIndex); it != m_zoomedIndexes.end(); ++it) {
+            affected << it.key();
+        }
+    }
+
+    for (const auto index : affected) {
+        setCleared(index);
+        deliver(direction, index, delegateIndex, newScale, step);
+    }
+}
+
+void ParabolicEngine::deliver(const Direction &direction, const int &index, int delegateIndex, qreal newScale, qreal step)
+{
+    //! items may register or unregister while a scale is delivered
+    const QList<parabolicItem> items = m_items.values(index);
+    const char *function = (direction == Lower ? "sltUpdateLowerItemScale" : "sltUpdateHigherItemScale");
+
+    for (const auto &pitem : items) {
+        if (!pitem.item) {
+            continue;
+        }
+
+        QMetaObject::invokeMethod(pitem.item,
+                                  function,
+                                  Q_ARG(QVariant, delegateIndex),
+                                  Q_ARG(QVariant, newScale),
+                                  Q_ARG(QVariant, step));
+    }
+}
+
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2020  Michail Vourlakos <mvourlakos@gmail.com>
+ *
+ * This file is part of Latte-Dock
+ *
+ * Latte-Dock is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License, or (at your option) any later version.
+ *
+ * Latte-Dock is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef LATTEPARABOLICENGINE_H
+#define LATTEPARABOLICENGINE_H
+
+// Qt
+#include <QHash>
+#include <QMap>
+#include <QObject>
+#include <QPointer>
+#include <QVariantMap>
+
+namespace Latte {
+
+//! Delivers parabolic scale updates only to the items that are affected by them.
+//! Items are registered based on their index and must provide the
+//! sltUpdateLowerItemScale(delegateIndex, newScale, step) and
+//! sltUpdateHigherItemScale(delegateIndex, newScale, step) functions.
+//! Containers are items that forward scales to their own children, e.g. the tasks
+//! plasmoid inside a dock, and they always receive zoom clearing requests
+//! The engine computes only the scales of the two neighbours of the hovered item.
+//! Items still pass a scale on to their own neighbour when they are separators or
+//! hidden, and containers pass it to the engine of their children through the
+//! abilities bridge, so the curve is not computed for all items in one pass
+class ParabolicEngine : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ParabolicEngine(QObject *parent = nullptr);
+    ~ParabolicEngine() override;
+
+    Q_INVOKABLE void registerItem(QObject *item, int index, bool isContainer = false);
+    Q_INVOKABLE void unregisterItem(QObject *item);
+
+    //! returns {leftScale, rightScale} for the neighbours of the hovered item
+    Q_INVOKABLE QVariantMap applyParabolicEffect(int index, qreal currentMousePosition, qreal center, qreal zoom, bool isReversed);
+
+public slots:
+    void clearZoom();
+    void updateLowerItemScale(int delegateIndex, qreal newScale, qreal step);
+    void updateHigherItemScale(int delegateIndex, qreal newScale, qreal step);
+
+private:
+    struct parabolicItem {
+        QPointer<QObject> item;
+        bool isContainer{false};
+    };
+
+    enum Direction {
+        Lower = 0,
+        Higher
+    };
+
+    bool hasContainer(const int &index) const;
+    void setCleared(const int &index);
+
+    void updateItemScale(const Direction &direction, int delegateIndex, qreal newScale, qreal step);
+    void deliver(const Direction &direction, const int &index, int delegateIndex, qreal newScale, qreal step);
+
+private:
+    QMultiMap<int, parabolicItem> m_items;
+    QHash<QObject *, int> m_indexes;
+
+    //! index, last scale that was applied to it. Only items that are present
+    //! in here need to be informed when zoom is cleared
+    QMap<int, qreal> m_zoomedIndexes;
+};
+
+}
+
+#endif